@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AI/MythosStateTreeEnemyAbility.h"
+#include "Core/Subsystem/MythosEnemyAbilityBatchSubsystem.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "StateTreeExecutionContext.h"
+#include "Engine/World.h"
+
+static UMythosEnemyAbilityBatchSubsystem* GetBatchSubsystem(const AActor* Actor)
+{
+	UWorld* World = Actor ? Actor->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UMythosEnemyAbilityBatchSubsystem>() : nullptr;
+}
+
+EStateTreeRunStatus FMythosStateTreeActivateEnemyAbilityTask::EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+	InstanceData.Target = nullptr;
+
+	UMythosEnemyAbilityBatchSubsystem* Batch = GetBatchSubsystem(InstanceData.Enemy);
+	if (!Batch)
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	InstanceData.RequestId = Batch->RequestAbility(InstanceData.Enemy, InstanceData.AbilityTag, InstanceData.TargetFilter, InstanceData.Range);
+	return InstanceData.RequestId != INDEX_NONE ? EStateTreeRunStatus::Running : EStateTreeRunStatus::Failed;
+}
+
+EStateTreeRunStatus FMythosStateTreeActivateEnemyAbilityTask::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	UMythosEnemyAbilityBatchSubsystem* Batch = GetBatchSubsystem(InstanceData.Enemy);
+	if (!Batch)
+	{
+		return EStateTreeRunStatus::Failed;
+	}
+
+	AActor* Target = nullptr;
+	switch (Batch->GetRequestStatus(InstanceData.RequestId, &Target))
+	{
+	case EMythosAbilityRequestStatus::Pending:
+		return EStateTreeRunStatus::Running;
+
+	case EMythosAbilityRequestStatus::Activated:
+		InstanceData.Target = Target;
+		return EStateTreeRunStatus::Succeeded;
+
+	default:
+		return EStateTreeRunStatus::Failed;
+	}
+}
+
+void FMythosStateTreeActivateEnemyAbilityTask::ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	// Leaving while still pending also gives up the place in the attack token queue
+	if (UMythosEnemyAbilityBatchSubsystem* Batch = GetBatchSubsystem(InstanceData.Enemy))
+	{
+		Batch->ReleaseRequest(InstanceData.RequestId);
+	}
+	InstanceData.RequestId = INDEX_NONE;
+}
+
+void FMythosStateTreeEnemyTargetEvaluator::Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const
+{
+	FInstanceDataType& InstanceData = Context.GetInstanceData(*this);
+
+	float Distance = 0.0f;
+	UMythosEnemyAbilityBatchSubsystem* Batch = GetBatchSubsystem(InstanceData.Enemy);
+	InstanceData.Target = Batch ? Batch->FindNearestTarget(InstanceData.Enemy, InstanceData.TargetFilter, InstanceData.SearchRange, &Distance) : nullptr;
+	InstanceData.bHasTarget = InstanceData.Target != nullptr;
+	InstanceData.TargetDistance = InstanceData.bHasTarget ? Distance : 0.0f;
+	InstanceData.ThreatTarget = InstanceData.Enemy ? InstanceData.Enemy->GetTopThreatTarget() : nullptr;
+}
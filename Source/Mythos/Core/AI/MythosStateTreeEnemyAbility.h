@@ -0,0 +1,98 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "StateTreeTaskBase.h"
+#include "StateTreeEvaluatorBase.h"
+#include "GameplayTagContainer.h"
+#include "MythosStateTreeEnemyAbility.generated.h"
+
+class AMythosEnemyBase;
+class AMythosCharacter;
+
+USTRUCT()
+struct FMythosActivateEnemyAbilityTaskInstanceData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Context")
+	TObjectPtr<AMythosEnemyBase> Enemy = nullptr;
+
+	// ability to activate, e.g. EnemyAbility.Spear.LightAttack
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	FGameplayTag AbilityTag;
+
+	// only targets with this tag, e.g. CharacterType.Player
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	FGameplayTag TargetFilter;
+
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	float Range = 200.0f;
+
+	// target the ability was activated against
+	UPROPERTY(EditAnywhere, Category = "Output")
+	TObjectPtr<AActor> Target = nullptr;
+
+	int32 RequestId = INDEX_NONE;
+};
+
+/**
+ * Queues the ability on UMythosEnemyAbilityBatchSubsystem and waits for the batch to resolve it.
+ * Succeeds once the ability activated, fails when there was no target or the activation failed.
+ */
+USTRUCT(meta = (DisplayName = "Mythos Activate Enemy Ability", Category = "Mythos"))
+struct MYTHOS_API FMythosStateTreeActivateEnemyAbilityTask : public FStateTreeTaskCommonBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FMythosActivateEnemyAbilityTaskInstanceData;
+
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+	virtual EStateTreeRunStatus EnterState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+	virtual EStateTreeRunStatus Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+	virtual void ExitState(FStateTreeExecutionContext& Context, const FStateTreeTransitionResult& Transition) const override;
+};
+
+USTRUCT()
+struct FMythosEnemyTargetEvaluatorInstanceData
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, Category = "Context")
+	TObjectPtr<AMythosEnemyBase> Enemy = nullptr;
+
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	FGameplayTag TargetFilter;
+
+	UPROPERTY(EditAnywhere, Category = "Parameter")
+	float SearchRange = 2000.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Output")
+	TObjectPtr<AMythosCharacter> Target = nullptr;
+
+	UPROPERTY(EditAnywhere, Category = "Output")
+	float TargetDistance = 0.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Output")
+	bool bHasTarget = false;
+
+	// top of the enemy's threat table, null until someone hurt it
+	UPROPERTY(EditAnywhere, Category = "Output")
+	TObjectPtr<AActor> ThreatTarget = nullptr;
+};
+
+/**
+ * Nearest target for state conditions (chase, attack range...), read from the batch subsystem's
+ * shared per-frame grid rather than a sweep per enemy.
+ */
+USTRUCT(meta = (DisplayName = "Mythos Enemy Target", Category = "Mythos"))
+struct MYTHOS_API FMythosStateTreeEnemyTargetEvaluator : public FStateTreeEvaluatorCommonBase
+{
+	GENERATED_BODY()
+
+	using FInstanceDataType = FMythosEnemyTargetEvaluatorInstanceData;
+
+	virtual const UStruct* GetInstanceDataType() const override { return FInstanceDataType::StaticStruct(); }
+	virtual void Tick(FStateTreeExecutionContext& Context, const float DeltaTime) const override;
+};
@@ -0,0 +1,132 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AI/MythosThreatTable.h"
+#include "GameFramework/Actor.h"
+
+// entries below this are forgotten
+static constexpr float MinThreat = 1.0f;
+
+void FMythosThreatTable::AddThreat(AActor* Actor, float Amount, double Now, float HalfLife)
+{
+	if (!Actor || Amount <= 0.0f)
+	{
+		return;
+	}
+
+	Decay(Now, HalfLife);
+
+	int32 Index = Find(Actor);
+	if (Index == INDEX_NONE)
+	{
+		if (Num < Capacity)
+		{
+			Index = Num++;
+		}
+		else if (Amount > Entries[Num - 1].Threat)
+		{
+			Index = Num - 1;
+		}
+		else
+		{
+			return;
+		}
+
+		Entries[Index].Actor = Actor;
+		Entries[Index].Threat = 0.0f;
+	}
+
+	Entries[Index].Threat += Amount;
+	SiftUp(Index);
+}
+
+void FMythosThreatTable::Decay(double Now, float HalfLife)
+{
+	const double Elapsed = Now - LastDecayTime;
+	LastDecayTime = Now;
+	if (Num == 0)
+	{
+		return;
+	}
+
+	// No time passed (several calls in one frame) still prunes destroyed actors, only the scale is skipped
+	const float Factor = Elapsed > 0.0 && HalfLife > 0.0f ? static_cast<float>(FMath::Pow(0.5, Elapsed / HalfLife)) : 1.0f;
+
+	// Sorted order survives a uniform scale, only compact out what dropped away
+	int32 Write = 0;
+	for (int32 Read = 0; Read < Num; ++Read)
+	{
+		FEntry& Entry = Entries[Read];
+		Entry.Threat *= Factor;
+		if (Entry.Threat >= MinThreat && Entry.Actor.IsValid())
+		{
+			if (Write != Read)
+			{
+				Entries[Write] = MoveTemp(Entry);
+			}
+			++Write;
+		}
+	}
+	for (int32 Index = Write; Index < Num; ++Index)
+	{
+		Entries[Index] = FEntry();
+	}
+	Num = Write;
+}
+
+AActor* FMythosThreatTable::GetTopThreat(double Now, float HalfLife)
+{
+	Decay(Now, HalfLife);
+	return Num > 0 ? Entries[0].Actor.Get() : nullptr;
+}
+
+void FMythosThreatTable::Remove(const AActor* Actor)
+{
+	const int32 Index = Find(Actor);
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	for (int32 Move = Index; Move < Num - 1; ++Move)
+	{
+		Entries[Move] = MoveTemp(Entries[Move + 1]);
+	}
+	Entries[--Num] = FEntry();
+}
+
+void FMythosThreatTable::Reset()
+{
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		Entries[Index] = FEntry();
+	}
+	Num = 0;
+}
+
+float FMythosThreatTable::GetThreat(const AActor* Actor) const
+{
+	const int32 Index = Find(Actor);
+	return Index != INDEX_NONE ? Entries[Index].Threat : 0.0f;
+}
+
+int32 FMythosThreatTable::Find(const AActor* Actor) const
+{
+	for (int32 Index = 0; Index < Num; ++Index)
+	{
+		if (Entries[Index].Actor.Get() == Actor)
+		{
+			return Index;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void FMythosThreatTable::SiftUp(int32 Index)
+{
+	while (Index > 0 && Entries[Index].Threat > Entries[Index - 1].Threat)
+	{
+		Swap(Entries[Index], Entries[Index - 1]);
+		--Index;
+	}
+}
@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Who an enemy is most angry at.
+ * A small array kept sorted by threat, highest first, so the top target is Entries[0].
+ * All entries decay by the same factor, which keeps the order, so decay is applied lazily
+ * whenever the table is touched instead of every frame.
+ */
+struct MYTHOS_API FMythosThreatTable
+{
+	static constexpr int32 Capacity = 8;
+
+	struct FEntry
+	{
+		TWeakObjectPtr<AActor> Actor;
+		float Threat = 0.0f;
+	};
+
+	// Add threat for Actor; when the table is full the lowest entry is replaced if Actor beats it
+	void AddThreat(AActor* Actor, float Amount, double Now, float HalfLife);
+
+	// Bring every entry to Now and drop the ones that decayed away or whose actor is gone
+	void Decay(double Now, float HalfLife);
+
+	void Remove(const AActor* Actor);
+
+	void Reset();
+
+	// Decays first so an entry that faded out or lost its actor is never returned
+	AActor* GetTopThreat(double Now, float HalfLife);
+
+	float GetThreat(const AActor* Actor) const;
+
+	bool Contains(const AActor* Actor) const { return Find(Actor) != INDEX_NONE; }
+
+	bool IsEmpty() const { return Num == 0; }
+
+	TConstArrayView<FEntry> GetEntries() const { return TConstArrayView<FEntry>(Entries, Num); }
+
+private:
+	int32 Find(const AActor* Actor) const;
+
+	// Move the entry at Index up until the array is sorted again
+	void SiftUp(int32 Index);
+
+	FEntry Entries[Capacity];
+	int32 Num = 0;
+	double LastDecayTime = 0.0;
+};
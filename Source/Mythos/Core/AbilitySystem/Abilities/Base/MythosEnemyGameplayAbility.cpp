@@ -3,3 +3,9 @@
 
 #include "Core/AbilitySystem/Abilities/Base/MythosEnemyGameplayAbility.h"
 
+UMythosEnemyGameplayAbility::UMythosEnemyGameplayAbility()
+{
+	// Per actor would keep one UObject per enemy per granted ability (2,000 for 500 enemies with 4 abilities);
+	// a short-lived instance per cast only exists while the cast runs. NonInstanced is deprecated since 5.5.
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerExecution;
+}
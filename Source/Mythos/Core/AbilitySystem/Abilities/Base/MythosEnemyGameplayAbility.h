@@ -7,11 +7,16 @@
 #include "MythosEnemyGameplayAbility.generated.h"
 
 /**
- * 
+ * Base for abilities granted to mass enemies.
+ * Instanced per execution: granting creates no UObject, a cast creates one that is released when it ends,
+ * so live ability instances follow the number of casts in flight, not the number of enemies.
+ * Run state lives in FMythosAbilityActivationContext on that instance.
  */
 UCLASS()
 class MYTHOS_API UMythosEnemyGameplayAbility : public UMythosGameplayAbility
 {
 	GENERATED_BODY()
-	
+
+public:
+	UMythosEnemyGameplayAbility();
 };
@@ -13,9 +13,28 @@
 #include "Kismet/GameplayStatics.h"
 #include "GameFramework/Character.h"
 #include "GameplayTagAssetInterface.h"
-#include "DrawDebugHelpers.h"
 #include "MythosCharacter.h"
 #include "Abilities/GameplayAbility.h"
+#include "Core/AbilitySystem/Tags/MythosTagBits.h"
+#include "Core/AbilitySystem/Component/MythosAbilityEffects.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/Subsystem/MythosPresentationSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosTrace.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "Core/Debug/MythosDebug.h"
+
+static TAutoConsoleVariable<bool> CVarMythosPredictCostAndCooldown(
+    TEXT("Mythos.Ability.PredictCostAndCooldown"),
+    true,
+    TEXT("Apply ability cost and cooldown on the owning client under the activation prediction key. 0 waits for the server."),
+    ECVF_Default);
+
+// true if the actor passes the ability's tag filter, an invalid filter lets everything through
+static bool PassesTagFilter(const AActor* Actor, const FGameplayTag& TagFilter, MythosTagBits::FMask FilterMask)
+{
+    return !TagFilter.IsValid() || MythosTagBits::ActorMatchesTag(Actor, TagFilter, FilterMask);
+}
 
 UMythosGameplayAbility::UMythosGameplayAbility()
 {
@@ -24,6 +43,9 @@ UMythosGameplayAbility::UMythosGameplayAbility()
     bCanUseWhileMoving = true;
     bCanBeInterrupted = true;
     
+    // Player abilities keep one instance per owner, enemies override this (see UMythosEnemyGameplayAbility)
+    InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+
     // Skill range parameter default values
     AbilityDistance = 200.0f;
     AbilityAngle = 90.0f;
@@ -36,41 +58,50 @@ UMythosGameplayAbility::UMythosGameplayAbility()
 
 void UMythosGameplayAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
+    MYTHOS_SCOPE_STAT(AbilityActivate);
+    INC_DWORD_STAT(STAT_MythosAbilitiesActivated);
+    ++FMythosCombatCounters::Get().AbilityActivations;
+
     // Call parent class activation method
     Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
     //UE_LOG(LogTemp, Warning, TEXT("CheckCost called: CostValue=%.2f, CostAttribute=%s"), CostValue.GetValue(), *CostAttribute.GetName());
 
-    // get ASC from avatar actor
-    AActor* Avatar = GetAvatarActorFromActorInfo();
-    if (Avatar)
-    {
-        AMythosCharacter* MC = Cast<AMythosCharacter>(Avatar);
-        if (MC)
-        {
-            ASC = MC->GetAbilitySystemComponent();
-        }
-        else
-        {
-            ASC = nullptr;
-        }
-    }
-    else
-    {
-        ASC = nullptr;
-    }
+    // per-activation state, the ability itself is only read from here on
+    FMythosAbilityActivationContext Context;
+    Context.ASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+    MYTHOS_TRACE(AbilityActivated, this, ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr, static_cast<uint8>(AbilityType), Context.TraceActivationId, Context.TraceRegionId);
 
     // Check cost
     if (!CheckCost(Handle, ActorInfo))
     {
+        // EndAbility closes the trace region of this activation, not the previous one's
+        if (IsInstantiated())
+        {
+            ActivationContext = Context;
+        }
         EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
         return;
     }
 
     // Apply cost
-    ApplyCost(Handle, ActorInfo, ActivationInfo);
+    Context.CostEffectHandle = ApplyCost(Handle, ActorInfo, ActivationInfo);
 
     // Apply cooldown
-    ApplyCooldown(Handle, ActorInfo, ActivationInfo);
+    Context.CooldownEffectHandle = ApplyCooldown(Handle, ActorInfo, ActivationInfo);
+
+    // Only instances may keep state, a non-instanced ability runs on the shared CDO
+    if (IsInstantiated())
+    {
+        ASC = Context.ASC.Get();
+        ActivationContext = Context;
+
+        // GAS rolls the predicted cost and cooldown back on its own, this only tells BP (UI) about it
+        if (IsPredictingClient())
+        {
+            FPredictionKey PredictionKey = ActivationInfo.GetActivationPredictionKey();
+            PredictionKey.NewRejectedDelegate().BindUObject(this, &UMythosGameplayAbility::HandleActivationRejected);
+        }
+    }
 
     // Start smooth rotation to mouse position
     StartSmoothRotationToMouse();
@@ -95,47 +126,135 @@ void UMythosGameplayAbility::EndAbility(const FGameplayAbilitySpecHandle Handle,
         OnAbilityEnded();
     }
 
+    // EndAbility also runs on instances that already ended, only the first end closes the trace region
+    if (IsActive())
+    {
+        MYTHOS_TRACE(AbilityEnded, this, ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr, ActivationContext.TraceActivationId, ActivationContext.TraceRegionId, bWasCancelled);
+    }
+
     Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
 }
 
-void UMythosGameplayAbility::ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const
+FActiveGameplayEffectHandle UMythosGameplayAbility::ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const
+{
+    LLM_SCOPE_BYTAG(Mythos_Effects);
+
+    if (CooldownDuration.GetValue() <= 0.0f)
+    {
+        return FActiveGameplayEffectHandle();
+    }
+
+    FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, ActivationInfo, UMythosCooldownEffect::StaticClass(), GetAbilityLevel(Handle, ActorInfo));
+    if (!SpecHandle.IsValid())
+    {
+        return FActiveGameplayEffectHandle();
+    }
+    SpecHandle.Data->SetSetByCallerMagnitude(UMythosCooldownEffect::DurationName, CooldownDuration.GetValue());
+
+    // Every ability shares the cooldown class, the tags that block this one come with the spec
+    SpecHandle.Data->DynamicGrantedTags.AppendTags(CooldownTags);
+
+    return ApplyPredictedSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
+}
+
+FActiveGameplayEffectHandle UMythosGameplayAbility::ApplyCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const
 {
-    if (CooldownDuration.GetValue() > 0.0f)
+    LLM_SCOPE_BYTAG(Mythos_Effects);
+
+    if (CostValue.GetValue() <= 0.0f || !CostAttribute.IsValid())
     {
-        // Create Cooldown and apply
-        UGameplayEffect* CooldownEffect = NewObject<UGameplayEffect>();
-        CooldownEffect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
-        CooldownEffect->Period = 0.0f;
-        CooldownEffect->DurationMagnitude = FScalableFloat(CooldownDuration.GetValue());
+        return FActiveGameplayEffectHandle();
+    }
+
+    const TSubclassOf<UGameplayEffect> CostEffectClass = UMythosCostEffect::GetCostEffectClass(CostAttribute);
+    if (!CostEffectClass)
+    {
+        // No cost class for this attribute, fall back to a transient GE that only the server applies
+        if (!ActorInfo->IsNetAuthority())
+        {
+            return FActiveGameplayEffectHandle();
+        }
 
-        if (UAbilitySystemComponent* LocalASC = ActorInfo->AbilitySystemComponent.Get())
+        UAbilitySystemComponent* LocalASC = ActorInfo->AbilitySystemComponent.Get();
+        if (!LocalASC)
         {
-            const_cast<UMythosGameplayAbility*>(this)->CooldownEffectHandle = LocalASC->ApplyGameplayEffectToSelf(CooldownEffect, 1.0f, LocalASC->MakeEffectContext());
+            return FActiveGameplayEffectHandle();
         }
+
+        FGameplayEffectSpec CostSpec(UMythosCostEffect::GetFallbackCostEffect(CostAttribute), LocalASC->MakeEffectContext(), 1.0f);
+        CostSpec.SetSetByCallerMagnitude(UMythosCostEffect::MagnitudeName, -CostValue.GetValue());
+        return LocalASC->ApplyGameplayEffectSpecToSelf(CostSpec);
+    }
+
+    FGameplayEffectSpecHandle SpecHandle = MakeOutgoingGameplayEffectSpec(Handle, ActorInfo, ActivationInfo, CostEffectClass, GetAbilityLevel(Handle, ActorInfo));
+    if (!SpecHandle.IsValid())
+    {
+        return FActiveGameplayEffectHandle();
+    }
+    SpecHandle.Data->SetSetByCallerMagnitude(UMythosCostEffect::MagnitudeName, -CostValue.GetValue());
+
+    return ApplyPredictedSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
+}
+
+FActiveGameplayEffectHandle UMythosGameplayAbility::ApplyPredictedSpecToOwner(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEffectSpecHandle& SpecHandle) const
+{
+    // Under the activation's prediction key the owning client applies the spec right away and GAS
+    // removes it again if the server rejects the activation; the server's copy replaces it otherwise
+    if (CVarMythosPredictCostAndCooldown.GetValueOnGameThread())
+    {
+        return ApplyGameplayEffectSpecToOwner(Handle, ActorInfo, ActivationInfo, SpecHandle);
+    }
+
+    // Unpredicted: wait for the server like before
+    UAbilitySystemComponent* LocalASC = ActorInfo->AbilitySystemComponent.Get();
+    if (!LocalASC || !ActorInfo->IsNetAuthority())
+    {
+        return FActiveGameplayEffectHandle();
     }
+    return LocalASC->ApplyGameplayEffectSpecToSelf(*SpecHandle.Data.Get(), FPredictionKey());
 }
 
-void UMythosGameplayAbility::ApplyCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const
+void UMythosGameplayAbility::HandleActivationRejected()
 {
-    if (CostValue.GetValue() > 0.0f && CostAttribute.IsValid())
+    if (UMythosAbilitySystemComponent* MythosASC = Cast<UMythosAbilitySystemComponent>(GetAbilitySystemComponentFromActorInfo()))
     {
-        // Creat GE
-        UGameplayEffect* CostEffect = NewObject<UGameplayEffect>();
-        CostEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+        MythosASC->OnAbilityPredictionRejected.Broadcast();
+    }
+    OnPredictionRejected();
+}
+
+const FGameplayTagContainer* UMythosGameplayAbility::GetCooldownTags() const
+{
+    return CooldownTags.IsEmpty() ? Super::GetCooldownTags() : &CooldownTags;
+}
+
+bool UMythosGameplayAbility::CheckCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, OUT FGameplayTagContainer* OptionalRelevantTags) const
+{
+    if (!CooldownTags.IsEmpty() || CooldownDuration.GetValue() <= 0.0f)
+    {
+        return Super::CheckCooldown(Handle, ActorInfo, OptionalRelevantTags);
+    }
 
-        // Set modifier for GE
-        FGameplayModifierInfo CostModifier;
-        CostModifier.Attribute = CostAttribute;
-        CostModifier.ModifierOp = EGameplayModOp::Additive;
-        CostModifier.ModifierMagnitude = FScalableFloat(-CostValue.GetValue());
-        CostEffect->Modifiers.Add(CostModifier);
+    // No tags to block on, look for a cooldown this ability applied (the predicted one counts too)
+    const UAbilitySystemComponent* LocalASC = ActorInfo ? ActorInfo->AbilitySystemComponent.Get() : nullptr;
+    if (!LocalASC)
+    {
+        return true;
+    }
 
-        // Apply GE
-        if (UAbilitySystemComponent* LocalASC = ActorInfo->AbilitySystemComponent.Get())
+    // A bound CustomMatchDelegate makes the query ignore EffectDefinition, so the lambda checks the class itself
+    const UClass* AbilityClass = GetClass();
+    FGameplayEffectQuery Query;
+    Query.CustomMatchDelegate.BindLambda([AbilityClass](const FActiveGameplayEffect& Effect)
+    {
+        if (!Effect.Spec.Def || !Effect.Spec.Def->IsA<UMythosCooldownEffect>())
         {
-            const_cast<UMythosGameplayAbility*>(this)->CostEffectHandle = LocalASC->ApplyGameplayEffectToSelf(CostEffect, 1.0f, LocalASC->MakeEffectContext());
+            return false;
         }
-    }
+        const UGameplayAbility* SourceAbility = Effect.Spec.GetContext().GetAbility();
+        return SourceAbility && SourceAbility->GetClass() == AbilityClass;
+    });
+    return LocalASC->GetActiveGameplayEffects().GetActiveEffectCount(Query) == 0;
 }
 
 UFUNCTION(BlueprintCallable, Category="Ability")
@@ -156,29 +275,68 @@ bool UMythosGameplayAbility::CheckCost(const FGameplayAbilitySpecHandle Handle,
     return false;
 }
 
+void UMythosGameplayAbility::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+    for (const FSoftObjectPath& Path : { AbilityMontage.ToSoftObjectPath(), AbilitySound.ToSoftObjectPath(), AbilityEffect.ToSoftObjectPath() })
+    {
+        if (!Path.IsNull())
+        {
+            OutAssets.Add(Path);
+        }
+    }
+}
+
+// Presentation only uses what is already loaded, never a sync load in the middle of a cast
+
 void UMythosGameplayAbility::PlayAbilityAnimation()
 {
-    if (AbilityMontage && GetOwningActorFromActorInfo())
+    UAnimMontage* Montage = AbilityMontage.Get();
+    UAbilitySystemComponent* OwnerASC = GetAbilitySystemComponentFromActorInfo();
+    if (Montage && OwnerASC && IsInstantiated())
     {
-        // if we need do something here
-        //we can use default function in 
+        // Through the ASC so the montage replicates to simulated proxies and is tied to this activation
+        OwnerASC->PlayMontage(this, GetCurrentActivationInfo(), Montage, 1.0f);
+    }
+    else if (!AbilityMontage.IsNull() && !Montage)
+    {
+        UE_LOG(LogMythosAbility, Verbose, TEXT("%s: montage %s not preloaded"), *GetName(), *AbilityMontage.ToString());
     }
 }
 
 void UMythosGameplayAbility::PlayAbilitySound()
 {
-    if (AbilitySound && GetOwningActorFromActorInfo())
+#if !UE_SERVER
+    USoundBase* Sound = AbilitySound.Get();
+    const AActor* Avatar = GetAvatarActorFromActorInfo();
+    UMythosPresentationSubsystem* Presentation = Avatar ? Avatar->GetWorld()->GetSubsystem<UMythosPresentationSubsystem>() : nullptr;
+    if (Sound && Presentation)
     {
-        // sound logic, 
+        Presentation->PlaySound(Sound, Avatar->GetActorLocation(), GetPresentationPriority());
     }
+#endif
 }
 
 void UMythosGameplayAbility::PlayAbilityEffect()
 {
-    if (AbilityEffect && GetOwningActorFromActorInfo())
+#if !UE_SERVER
+    // No subsystem on dedicated servers
+    UParticleSystem* Effect = AbilityEffect.Get();
+    const AActor* Avatar = GetAvatarActorFromActorInfo();
+    UMythosPresentationSubsystem* Presentation = Avatar ? Avatar->GetWorld()->GetSubsystem<UMythosPresentationSubsystem>() : nullptr;
+    if (Effect && Presentation)
     {
+        Presentation->PlayEffect(Effect, Avatar->GetActorTransform(), GetPresentationPriority());
+    }
+#endif
+}
 
+EMythosPresentationPriority UMythosGameplayAbility::GetPresentationPriority() const
+{
+    if (IsLocallyControlled())
+    {
+        return EMythosPresentationPriority::High;
     }
+    return Cast<AMythosEnemyBase>(GetAvatarActorFromActorInfo()) ? EMythosPresentationPriority::Low : EMythosPresentationPriority::Normal;
 }
 
 const UMythosAttributeSet* UMythosGameplayAbility::GetMythosAttributeSet() const
@@ -261,12 +419,12 @@ float UMythosGameplayAbility::GetEffectRadius() const
 
 void UMythosGameplayAbility::BPApplyCooldown()
 {
-    ApplyCooldown(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo());
+    ActivationContext.CooldownEffectHandle = ApplyCooldown(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo());
 }
 
 void UMythosGameplayAbility::BPApplyCost()
 {
-    ApplyCost(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo());
+    ActivationContext.CostEffectHandle = ApplyCost(GetCurrentAbilitySpecHandle(), GetCurrentActorInfo(), GetCurrentActivationInfo());
 }
 
 bool UMythosGameplayAbility::BPCheckCost()
@@ -277,7 +435,13 @@ bool UMythosGameplayAbility::BPCheckCost()
 // get all characters in the range of the ability by trace
 TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter)
 {
+    MYTHOS_SCOPE_STAT(AbilityTargets);
+    INC_DWORD_STAT(STAT_MythosTargetQueries);
+    FMythosTargetQueryScope QueryScope;
+
     TArray<AActor*> Result;
+    // resolve the filter to a bit once, every candidate is then a single AND
+    const MythosTagBits::FMask FilterMask = MythosTagBits::GetMask(TagFilter);
     AMythosCharacter* OwnerChar = Cast<AMythosCharacter>(GetAvatarActorFromActorInfo());
     if (!OwnerChar) return Result;
 
@@ -313,7 +477,7 @@ TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter
                 TArray<FHitResult> HitResults;
                 FVector TraceCenter = Hit.Location;
                 float TraceRadius = AbilityRadius;
-                DrawDebugSphere(World, TraceCenter, TraceRadius, 32, FColor::Green, false, 2.0f);
+                MYTHOS_DEBUG_SPHERE(Targeting, World, TraceCenter, TraceRadius, FColor::Green, 2.0f);
                 World->SweepMultiByObjectType(
                     HitResults,
                     TraceCenter,
@@ -328,13 +492,7 @@ TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter
                     AActor* Actor = HR.GetActor();
                     if (Actor && Actor != OwnerChar)
                     {
-                        if (TagFilter.IsValid() && Actor->Implements<UGameplayTagAssetInterface>())
-                        {
-                            IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor);
-                            if (TagInterface && TagInterface->HasMatchingGameplayTag(TagFilter))
-                                Result.AddUnique(Actor);
-                        }
-                        else if (!TagFilter.IsValid())
+                        if (PassesTagFilter(Actor, TagFilter, FilterMask))
                         {
                             Result.AddUnique(Actor);
                         }
@@ -349,7 +507,7 @@ TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter
             TArray<FHitResult> HitResults;
             FVector TraceCenter = OwnerChar->GetActorLocation();
             float TraceRadius = AbilityRadius;
-            DrawDebugSphere(World, TraceCenter, TraceRadius, 32, FColor::Blue, false, 2.0f);
+            MYTHOS_DEBUG_SPHERE(Targeting, World, TraceCenter, TraceRadius, FColor::Blue, 2.0f);
             World->SweepMultiByObjectType(
                 HitResults,
                 TraceCenter,
@@ -364,13 +522,7 @@ TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter
                 AActor* Actor = HR.GetActor();
                 if (Actor && Actor != OwnerChar)
                 {
-                    if (TagFilter.IsValid() && Actor->Implements<UGameplayTagAssetInterface>())
-                    {
-                        IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor);
-                        if (TagInterface && TagInterface->HasMatchingGameplayTag(TagFilter))
-                            Result.AddUnique(Actor);
-                    }
-                    else if (!TagFilter.IsValid())
+                    if (PassesTagFilter(Actor, TagFilter, FilterMask))
                     {
                         Result.AddUnique(Actor);
                     }
@@ -392,7 +544,7 @@ TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter
             float TraceRadius = AbilityRadius;
             
             // Draw debug cone
-            DrawDebugCone(World, TraceStart, DirectionToMouse, AbilityDistance, FMath::DegreesToRadians(AbilityAngle * 0.5f), FMath::DegreesToRadians(AbilityAngle * 0.5f), 32, FColor::Red, false, 2.0f);
+            MYTHOS_DEBUG_CONE(Targeting, World, TraceStart, DirectionToMouse, AbilityDistance, FMath::DegreesToRadians(AbilityAngle * 0.5f), FColor::Red, 2.0f);
             
             // Use capsule trace for cone shape
             FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(TraceRadius, AbilityDistance * 0.5f);
@@ -411,13 +563,7 @@ TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter
                 AActor* Actor = HR.GetActor();
                 if (Actor && Actor != OwnerChar)
                 {
-                    if (TagFilter.IsValid() && Actor->Implements<UGameplayTagAssetInterface>())
-                    {
-                        IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor);
-                        if (TagInterface && TagInterface->HasMatchingGameplayTag(TagFilter))
-                            Result.AddUnique(Actor);
-                    }
-                    else if (!TagFilter.IsValid())
+                    if (PassesTagFilter(Actor, TagFilter, FilterMask))
                     {
                         Result.AddUnique(Actor);
                     }
@@ -431,13 +577,7 @@ TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter
             {
                 if (HitActor->IsA(AMythosCharacter::StaticClass()))
                 {
-                    if (TagFilter.IsValid() && HitActor->Implements<UGameplayTagAssetInterface>())
-                    {
-                        IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(HitActor);
-                        if (TagInterface && TagInterface->HasMatchingGameplayTag(TagFilter))
-                            Result.AddUnique(HitActor);
-                    }
-                    else if (!TagFilter.IsValid())
+                    if (PassesTagFilter(HitActor, TagFilter, FilterMask))
                     {
                         Result.AddUnique(HitActor);
                     }
@@ -448,6 +588,8 @@ TArray<AActor*> UMythosGameplayAbility::GetAbilityTargets(FGameplayTag TagFilter
         default:
             break;
     }
+    MYTHOS_TRACE(TargetQuery, this, OwnerChar, ActivationContext.TraceActivationId, Result.Num());
+    QueryScope.TargetsFound = Result.Num();
     return Result;
 }
 
@@ -491,7 +633,13 @@ bool UMythosGameplayAbility::GetMouseDirectionAndPosition(FVector& OutDirection,
 
 TArray<AActor*> UMythosGameplayAbility::GetEnemyAbilityTargets(FGameplayTag TagFilter)
 {
+    MYTHOS_SCOPE_STAT(EnemyAbilityTargets);
+    INC_DWORD_STAT(STAT_MythosTargetQueries);
+    FMythosTargetQueryScope QueryScope;
+
     TArray<AActor*> Result;
+    // resolve the filter to a bit once, every candidate is then a single AND
+    const MythosTagBits::FMask FilterMask = MythosTagBits::GetMask(TagFilter);
     AMythosCharacter* OwnerChar = Cast<AMythosCharacter>(GetAvatarActorFromActorInfo());
     if (!OwnerChar) return Result;
 
@@ -509,7 +657,7 @@ TArray<AActor*> UMythosGameplayAbility::GetEnemyAbilityTargets(FGameplayTag TagF
             TArray<FHitResult> HitResults;
             FVector TraceCenter = OwnerChar->GetActorLocation();
             float TraceRadius = SelfEffectRadius;
-            DrawDebugSphere(World, TraceCenter, TraceRadius, 32, FColor::Blue, false, 2.0f);
+            MYTHOS_DEBUG_SPHERE(Targeting, World, TraceCenter, TraceRadius, FColor::Blue, 2.0f);
             World->SweepMultiByObjectType(
                 HitResults,
                 TraceCenter,
@@ -524,13 +672,7 @@ TArray<AActor*> UMythosGameplayAbility::GetEnemyAbilityTargets(FGameplayTag TagF
                 AActor* Actor = HR.GetActor();
                 if (Actor && Actor != OwnerChar)
                 {
-                    if (TagFilter.IsValid() && Actor->Implements<UGameplayTagAssetInterface>())
-                    {
-                        IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor);
-                        if (TagInterface && TagInterface->HasMatchingGameplayTag(TagFilter))
-                            Result.AddUnique(Actor);
-                    }
-                    else if (!TagFilter.IsValid())
+                    if (PassesTagFilter(Actor, TagFilter, FilterMask))
                     {
                         Result.AddUnique(Actor);
                     }
@@ -550,7 +692,7 @@ TArray<AActor*> UMythosGameplayAbility::GetEnemyAbilityTargets(FGameplayTag TagF
             float TraceRadius = AbilityRadius;
             
             // Draw debug cone
-            DrawDebugCone(World, TraceStart, AttackDirection, AbilityDistance, FMath::DegreesToRadians(AbilityAngle * 0.5f), FMath::DegreesToRadians(AbilityAngle * 0.5f), 32, FColor::Red, false, 2.0f);
+            MYTHOS_DEBUG_CONE(Targeting, World, TraceStart, AttackDirection, AbilityDistance, FMath::DegreesToRadians(AbilityAngle * 0.5f), FColor::Red, 2.0f);
             
             // Use capsule trace for cone shape
             FCollisionShape CapsuleShape = FCollisionShape::MakeCapsule(TraceRadius, AbilityDistance * 0.5f);
@@ -569,13 +711,7 @@ TArray<AActor*> UMythosGameplayAbility::GetEnemyAbilityTargets(FGameplayTag TagF
                 AActor* Actor = HR.GetActor();
                 if (Actor && Actor != OwnerChar)
                 {
-                    if (TagFilter.IsValid() && Actor->Implements<UGameplayTagAssetInterface>())
-                    {
-                        IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor);
-                        if (TagInterface && TagInterface->HasMatchingGameplayTag(TagFilter))
-                            Result.AddUnique(Actor);
-                    }
-                    else if (!TagFilter.IsValid())
+                    if (PassesTagFilter(Actor, TagFilter, FilterMask))
                     {
                         Result.AddUnique(Actor);
                     }
@@ -591,7 +727,7 @@ TArray<AActor*> UMythosGameplayAbility::GetEnemyAbilityTargets(FGameplayTag TagF
             
             TArray<FHitResult> HitResults;
             float TraceRadius = AbilityRadius;
-            DrawDebugSphere(World, AoeCenter, TraceRadius, 32, FColor::Green, false, 2.0f);
+            MYTHOS_DEBUG_SPHERE(Targeting, World, AoeCenter, TraceRadius, FColor::Green, 2.0f);
             World->SweepMultiByObjectType(
                 HitResults,
                 AoeCenter,
@@ -607,13 +743,7 @@ TArray<AActor*> UMythosGameplayAbility::GetEnemyAbilityTargets(FGameplayTag TagF
                 AActor* Actor = HR.GetActor();
                 if (Actor && Actor != OwnerChar)
                 {
-                    if (TagFilter.IsValid() && Actor->Implements<UGameplayTagAssetInterface>())
-                    {
-                        IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor);
-                        if (TagInterface && TagInterface->HasMatchingGameplayTag(TagFilter))
-                            Result.AddUnique(Actor);
-                    }
-                    else if (!TagFilter.IsValid())
+                    if (PassesTagFilter(Actor, TagFilter, FilterMask))
                     {
                         Result.AddUnique(Actor);
                     }
@@ -624,6 +754,8 @@ TArray<AActor*> UMythosGameplayAbility::GetEnemyAbilityTargets(FGameplayTag TagF
         default:
             break;
     }
+    MYTHOS_TRACE(TargetQuery, this, OwnerChar, ActivationContext.TraceActivationId, Result.Num());
+    QueryScope.TargetsFound = Result.Num();
     return Result;
 }
 
@@ -682,6 +814,7 @@ void UMythosGameplayAbility::AddTagToActorForDuration(AActor* TargetActor, FGame
         }
     });
     
+    LLM_SCOPE_BYTAG(Mythos_AbilitySystem);
     GetWorld()->GetTimerManager().SetTimer(TimerHandle, TimerDelegate, Duration, false);
 }
 
@@ -808,11 +941,17 @@ bool UMythosGameplayAbility::FaceMousePositionSmooth(float CustomRotationSpeed)
 
 bool UMythosGameplayAbility::StartSmoothRotationToMouse()
 {
+    // Only the owning client has a cursor, the server and AI casters have nothing to face
+    if (!IsLocallyControlled())
+    {
+        return false;
+    }
+
     // Get the avatar actor (character)
     AMythosCharacter* OwnerChar = Cast<AMythosCharacter>(GetOwningActorFromActorInfo());
     if (!OwnerChar)
     {
-        UE_LOG(LogTemp, Warning, TEXT("StartSmoothRotationToMouse: No valid character found"));
+        UE_LOG(LogMythosAbility, Verbose, TEXT("StartSmoothRotationToMouse: No valid character found"));
         return false;
     }
 
@@ -820,7 +959,7 @@ bool UMythosGameplayAbility::StartSmoothRotationToMouse()
     AMythosPlayerController* PC = Cast<AMythosPlayerController>(OwnerChar->GetController());
     if (!PC)
     {
-        UE_LOG(LogTemp, Warning, TEXT("StartSmoothRotationToMouse: No valid player controller found"));
+        UE_LOG(LogMythosAbility, Verbose, TEXT("StartSmoothRotationToMouse: No valid player controller found"));
         return false;
     }
 
@@ -829,14 +968,14 @@ bool UMythosGameplayAbility::StartSmoothRotationToMouse()
     FHitResult Hit;
     if (!PC->GetMouseWorldPosition(MouseWorldLoc, MouseWorldDir, Hit))
     {
-        UE_LOG(LogTemp, Warning, TEXT("StartSmoothRotationToMouse: Failed to get mouse world position"));
+        UE_LOG(LogMythosAbility, Verbose, TEXT("StartSmoothRotationToMouse: Failed to get mouse world position"));
         return false;
     }
 
     // Check if we have a valid hit result
     if (!Hit.bBlockingHit)
     {
-        UE_LOG(LogTemp, Warning, TEXT("StartSmoothRotationToMouse: No blocking hit found"));
+        UE_LOG(LogMythosAbility, Verbose, TEXT("StartSmoothRotationToMouse: No blocking hit found"));
         return false;
     }
 
@@ -848,7 +987,7 @@ bool UMythosGameplayAbility::StartSmoothRotationToMouse()
     DirectionToMouse.Z = 0.0f; // Ignore Z axis, only consider horizontal direction
     DirectionToMouse = DirectionToMouse.GetSafeNormal();
     
-    UE_LOG(LogTemp, Warning, TEXT("Direction to mouse: %s"), *DirectionToMouse.ToString());
+    UE_LOG(LogMythosAbility, Verbose, TEXT("Direction to mouse: %s"), *DirectionToMouse.ToString());
 
     if (!DirectionToMouse.IsNearlyZero())
     {
@@ -859,11 +998,11 @@ bool UMythosGameplayAbility::StartSmoothRotationToMouse()
         // Call the character's smooth rotation method
         OwnerChar->SmoothRotateToDirection(DirectionToMouse, RotationDuration);
         
-        UE_LOG(LogTemp, Warning, TEXT("Started smooth rotation with speed: %.2f, duration: %.2f"), RotationSpeed, RotationDuration);
+        UE_LOG(LogMythosAbility, Verbose, TEXT("Started smooth rotation with speed: %.2f, duration: %.2f"), RotationSpeed, RotationDuration);
         
         return true;
     }
 
-    UE_LOG(LogTemp, Warning, TEXT("StartSmoothRotationToMouse: Direction to mouse is nearly zero"));
+    UE_LOG(LogMythosAbility, Verbose, TEXT("StartSmoothRotationToMouse: Direction to mouse is nearly zero"));
     return false;
 }
\ No newline at end of file
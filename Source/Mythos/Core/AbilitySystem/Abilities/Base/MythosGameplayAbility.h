@@ -7,6 +7,9 @@
 
 class UMythosAttributeSet;
 class UAnimMontage;
+class USoundBase;
+class UParticleSystem;
+enum class EMythosPresentationPriority : uint8;
 
 /**
  * Enum for different types of skills
@@ -28,6 +31,30 @@ enum class EMythosAbilityType : uint8
     Area UMETA(DisplayName = "Area")
 };
 
+/**
+ * State that belongs to one activation rather than to the ability.
+ * The ability's UPROPERTYs (type, range, cost, montage...) are read-only config shared from the CDO,
+ * everything written while the ability runs lives here, so the ability can also run without an instance.
+ */
+USTRUCT(BlueprintType)
+struct FMythosAbilityActivationContext
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mythos|Ability")
+    TWeakObjectPtr<UAbilitySystemComponent> ASC;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mythos|Ability")
+    FActiveGameplayEffectHandle CooldownEffectHandle;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Mythos|Ability")
+    FActiveGameplayEffectHandle CostEffectHandle;
+
+    // MythosCombat trace ids of this activation, 0 while the channel is off
+    uint32 TraceActivationId = 0;
+    uint64 TraceRegionId = 0;
+};
+
 /**
  * base class for all the skills
  */
@@ -57,6 +84,11 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability")
     FScalableFloat CooldownDuration;
 
+    // granted by the cooldown effect while it runs and checked before activating; without tags the
+    // cooldown is found by looking for this ability's UMythosCooldownEffect instead
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability")
+    FGameplayTagContainer CooldownTags;
+
     // 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability")
     FScalableFloat CostValue;
@@ -65,17 +97,20 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability")
     FGameplayAttribute CostAttribute;
 
+    // Presentation assets are soft so loading the ability class doesn't load them,
+    // they are streamed in when the ability is granted (see UMythosAbilitySystemComponent::PreloadAbilityAssets)
+
     // animation montage to play
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability")
-    UAnimMontage* AbilityMontage;
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability", meta = (AssetBundles = "Ability"))
+    TSoftObjectPtr<UAnimMontage> AbilityMontage;
 
     // sound effect. maybe we prefer using notify and meta sound?
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability")
-    USoundBase* AbilitySound;
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability", meta = (AssetBundles = "Ability"))
+    TSoftObjectPtr<USoundBase> AbilitySound;
 
     // GE
-    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability")
-    UParticleSystem* AbilityEffect;
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability", meta = (AssetBundles = "Ability"))
+    TSoftObjectPtr<UParticleSystem> AbilityEffect;
 
     // === area paras ===
     
@@ -107,6 +142,9 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability|Rotation", meta = (ClampMin = "1.0", ClampMax = "360.0"))
     float RotationSpeed = 180.0f;
 
+    // assets to stream in when the ability is granted, override to add more
+    virtual void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const;
+
     // === support function ===
     
     // get range of the GA
@@ -176,12 +214,26 @@ public:
     bool StartSmoothRotationToMouse();
 
 protected:
+    // owner ASC of the current activation, only set on instanced abilities
     UPROPERTY(BlueprintReadOnly, Category="Ability")
     UAbilitySystemComponent* ASC = nullptr;
 
-    void ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const;
+    // context of the current activation, only stored on instanced abilities
+    UPROPERTY(BlueprintReadOnly, Category = "Mythos|Ability")
+    FMythosAbilityActivationContext ActivationContext;
+
+    FActiveGameplayEffectHandle ApplyCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const;
+
+    FActiveGameplayEffectHandle ApplyCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const;
 
-    void ApplyCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo) const;
+    // apply cost/cooldown specs, predicted on the owning client when Mythos.Ability.PredictCostAndCooldown is on
+    FActiveGameplayEffectHandle ApplyPredictedSpecToOwner(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEffectSpecHandle& SpecHandle) const;
+
+    void HandleActivationRejected();
+
+    virtual const FGameplayTagContainer* GetCooldownTags() const override;
+
+    virtual bool CheckCooldown(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, OUT FGameplayTagContainer* OptionalRelevantTags = nullptr) const override;
 
     // check if can be used
     bool CheckCost(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, OUT FGameplayTagContainer* OptionalRelevantTags = nullptr) const;
@@ -203,6 +255,9 @@ protected:
 
     void PlayAbilityEffect();
 
+    // local player casts first, enemies last when the presentation budget is tight
+    EMythosPresentationPriority GetPresentationPriority() const;
+
     // get attribute set
     UFUNCTION(BlueprintCallable, Category = "Mythos|Ability")
     const UMythosAttributeSet* GetMythosAttributeSet() const;
@@ -216,10 +271,9 @@ protected:
     UFUNCTION(BlueprintImplementableEvent, Category = "Mythos|Ability")
     void OnAbilityInterrupted();
 
-private:
-    // Handke
-    FActiveGameplayEffectHandle CooldownEffectHandle;
-    FActiveGameplayEffectHandle CostEffectHandle;
+    // the server rejected a predicted activation, its cost and cooldown have been rolled back
+    UFUNCTION(BlueprintImplementableEvent, Category = "Mythos|Ability")
+    void OnPredictionRejected();
 };
 
 // === Example Skill Classes ===
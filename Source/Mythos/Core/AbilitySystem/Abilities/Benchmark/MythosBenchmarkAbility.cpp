@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AbilitySystem/Abilities/Benchmark/MythosBenchmarkAbility.h"
+#include "Core/AbilitySystem/Component/MythosAbilityEffects.h"
+#include "Core/AbilitySystem/Component/MythosAttributeSet.h"
+#include "Core/AbilitySystem/Tags/MythosGameplayTags.h"
+#include "AbilitySystemBlueprintLibrary.h"
+
+UMythosBenchmarkAbility::UMythosBenchmarkAbility()
+{
+	TargetFilter = MythosGameplayTags::CharacterType_Enemy;
+	EffectClass = UMythosDamageEffect::StaticClass();
+
+	// Cost and cooldown still run every cast; the cooldown stays well under the benchmark's
+	// cast schedule (each ability comes round every few seconds) so it never fails a cast
+	CostAttribute = UMythosAttributeSet::GetManaAttribute();
+	CostValue = FScalableFloat(10.0f);
+	CooldownDuration = FScalableFloat(0.25f);
+}
+
+void UMythosBenchmarkAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
+{
+	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
+
+	// Cost check failed, the base class already ended it
+	if (!IsActive())
+	{
+		return;
+	}
+
+	const TArray<AActor*> Targets = GetEnemyAbilityTargets(TargetFilter);
+	if (EffectClass && Targets.Num() > 0)
+	{
+		const FGameplayAbilityTargetDataHandle TargetData = UAbilitySystemBlueprintLibrary::AbilityTargetDataFromActorArray(Targets, false);
+		ApplyGameplayEffectToTarget(Handle, ActorInfo, ActivationInfo, TargetData, EffectClass, GetAbilityLevel(Handle, ActorInfo));
+	}
+
+	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
+}
+
+UMythosBenchmarkBoltAbility::UMythosBenchmarkBoltAbility()
+{
+	AbilityType = EMythosAbilityType::Directional;
+	AbilityDistance = 500.0f;
+	AbilityRadius = 50.0f;
+}
+
+UMythosBenchmarkFirewallAbility::UMythosBenchmarkFirewallAbility()
+{
+	AbilityType = EMythosAbilityType::Directional;
+	AbilityDistance = 300.0f;
+	AbilityAngle = 60.0f;
+	AbilityRadius = 100.0f;
+}
+
+UMythosBenchmarkExplosionAbility::UMythosBenchmarkExplosionAbility()
+{
+	AbilityType = EMythosAbilityType::Area;
+	AbilityDistance = 300.0f;
+	AbilityRadius = 150.0f;
+}
+
+UMythosBenchmarkHealingAuraAbility::UMythosBenchmarkHealingAuraAbility()
+{
+	AbilityType = EMythosAbilityType::Self;
+
+	// reaches the neighbours at the default grid spacing
+	SelfEffectRadius = 400.0f;
+	EffectClass = UMythosHealEffect::StaticClass();
+}
@@ -0,0 +1,72 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AbilitySystem/Abilities/Base/MythosEnemyGameplayAbility.h"
+#include "MythosBenchmarkAbility.generated.h"
+
+class UGameplayEffect;
+
+/**
+ * Ability cast by UMythosCombatBenchmarkSubsystem.
+ * Does on the server what the sample abilities do in Blueprint: queries targets for its ability type,
+ * applies EffectClass to them and ends in the same frame, so every cast goes through targeting,
+ * the damage / heal executions and the attribute set.
+ */
+UCLASS(Abstract)
+class MYTHOS_API UMythosBenchmarkAbility : public UMythosEnemyGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UMythosBenchmarkAbility();
+
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
+
+protected:
+	// applied to every target found
+	UPROPERTY(EditDefaultsOnly, Category = "Mythos|Benchmark")
+	TSubclassOf<UGameplayEffect> EffectClass;
+
+	// the benchmark grid is all enemies, so they target each other
+	UPROPERTY(EditDefaultsOnly, Category = "Mythos|Benchmark")
+	FGameplayTag TargetFilter;
+};
+
+// Narrow forward line, stands in for the fireball projectile
+UCLASS()
+class MYTHOS_API UMythosBenchmarkBoltAbility : public UMythosBenchmarkAbility
+{
+	GENERATED_BODY()
+
+public:
+	UMythosBenchmarkBoltAbility();
+};
+
+UCLASS()
+class MYTHOS_API UMythosBenchmarkFirewallAbility : public UMythosBenchmarkAbility
+{
+	GENERATED_BODY()
+
+public:
+	UMythosBenchmarkFirewallAbility();
+};
+
+UCLASS()
+class MYTHOS_API UMythosBenchmarkExplosionAbility : public UMythosBenchmarkAbility
+{
+	GENERATED_BODY()
+
+public:
+	UMythosBenchmarkExplosionAbility();
+};
+
+UCLASS()
+class MYTHOS_API UMythosBenchmarkHealingAuraAbility : public UMythosBenchmarkAbility
+{
+	GENERATED_BODY()
+
+public:
+	UMythosBenchmarkHealingAuraAbility();
+};
@@ -0,0 +1,204 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AbilitySystem/Abilities/Combo/MythosComboAbility.h"
+#include "Core/AbilitySystem/Abilities/Combo/MythosComboGraph.h"
+#include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
+#include "Abilities/Tasks/AbilityTask_PlayMontageAndWait.h"
+#include "Animation/AnimMontage.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+#include "TimerManager.h"
+
+UMythosComboAbility::UMythosComboAbility()
+{
+	// The next step re-activates the running instance
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+	bRetriggerInstancedAbility = true;
+}
+
+bool UMythosComboAbility::IsComboWindowOpen() const
+{
+	if (CurrentStep == INDEX_NONE)
+	{
+		return false;
+	}
+
+	// The tag is set by the window timer, trust it over comparing times on the opening frame
+	if (ActiveWindowTag.IsValid())
+	{
+		return true;
+	}
+
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return false;
+	}
+
+	const double Now = World->GetTimeSeconds();
+	return Now >= WindowOpenTime && Now <= WindowCloseTime;
+}
+
+bool UMythosComboAbility::CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags, const FGameplayTagContainer* TargetTags, FGameplayTagContainer* OptionalRelevantTags) const
+{
+	// Mid swing, only accept the input inside the window
+	if (IsActive() && !IsComboWindowOpen())
+	{
+		return false;
+	}
+
+	return Super::CanActivateAbility(Handle, ActorInfo, SourceTags, TargetTags, OptionalRelevantTags);
+}
+
+void UMythosComboAbility::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
+{
+	// Decide the step before the base class can end us on a failed cost. The previous step already ended
+	// (retrigger ends the running instance first), so go by what EndAbility saw and the window's close time
+	const bool bAdvance = bAdvanceOnActivate && CurrentStep != INDEX_NONE && GetWorld()->GetTimeSeconds() <= WindowCloseTime;
+	bAdvanceOnActivate = false;
+
+	int32 Step = ComboGraph && bAdvance ? ComboGraph->GetNextStep(CurrentStep) : INDEX_NONE;
+	if (Step == INDEX_NONE)
+	{
+		Step = 0;
+	}
+
+	Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
+	if (!IsActive())
+	{
+		return;
+	}
+
+	// Streamed in on grant, never loaded in the middle of a swing
+	const FMythosComboStep* StepData = ComboGraph ? ComboGraph->GetStep(Step) : nullptr;
+	UAnimMontage* Montage = ComboGraph ? ComboGraph->ComboMontage.Get() : nullptr;
+	if (!StepData || !Montage)
+	{
+		if (StepData && !ComboGraph->ComboMontage.IsNull())
+		{
+			UE_LOG(LogMythosAbility, Verbose, TEXT("%s: combo montage %s not preloaded"), *GetName(), *ComboGraph->ComboMontage.ToString());
+		}
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	CurrentStep = Step;
+
+	UWorld* World = GetWorld();
+	const double Now = World->GetTimeSeconds();
+	WindowOpenTime = Now + StepData->WindowStart;
+	WindowCloseTime = Now + StepData->WindowEnd;
+
+	UAbilitySystemComponent* OwnerASC = ActorInfo->AbilitySystemComponent.Get();
+	if (StepData->StepTag.IsValid())
+	{
+		ActiveStepTag = StepData->StepTag;
+		OwnerASC->AddLooseGameplayTag(ActiveStepTag);
+	}
+
+	UAbilityTask_PlayMontageAndWait* MontageTask = UAbilityTask_PlayMontageAndWait::CreatePlayMontageAndWaitProxy(
+		this, NAME_None, Montage, 1.0f, StepData->MontageSection);
+	MontageTask->OnBlendOut.AddDynamic(this, &UMythosComboAbility::HandleMontageCompleted);
+	MontageTask->OnInterrupted.AddDynamic(this, &UMythosComboAbility::HandleMontageInterrupted);
+	MontageTask->OnCancelled.AddDynamic(this, &UMythosComboAbility::HandleMontageInterrupted);
+	MontageTask->ReadyForActivation();
+
+	// The window tag is what fires buffered inputs, add it on the exact opening time
+	FTimerManager& TimerManager = World->GetTimerManager();
+	if (StepData->WindowEnd > StepData->WindowStart)
+	{
+		if (StepData->WindowStart > 0.0f)
+		{
+			TimerManager.SetTimer(WindowOpenTimer, this, &UMythosComboAbility::OpenComboWindow, StepData->WindowStart, false);
+		}
+		else
+		{
+			OpenComboWindow();
+		}
+		TimerManager.SetTimer(WindowCloseTimer, this, &UMythosComboAbility::CloseComboWindow, StepData->WindowEnd, false);
+	}
+
+	OnComboStepStarted(Step);
+}
+
+void UMythosComboAbility::EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled)
+{
+	// Already ended, a second end would drop the chain
+	if (!IsActive())
+	{
+		return;
+	}
+
+	// GAS ends the running instance with bWasCancelled=false when the next press retriggers it, and
+	// ClearStep closes the window, so decide here: ending inside the window keeps the chain for the
+	// next activation, an interruption or an end outside the window starts over
+	bAdvanceOnActivate = !bWasCancelled && IsComboWindowOpen();
+	ClearStep();
+
+	if (!bAdvanceOnActivate)
+	{
+		CurrentStep = INDEX_NONE;
+	}
+
+	Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+}
+
+void UMythosComboAbility::GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const
+{
+	Super::GatherPreloadAssets(OutAssets);
+
+	if (ComboGraph && !ComboGraph->ComboMontage.IsNull())
+	{
+		OutAssets.Add(ComboGraph->ComboMontage.ToSoftObjectPath());
+	}
+}
+
+void UMythosComboAbility::HandleMontageCompleted()
+{
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, false);
+}
+
+void UMythosComboAbility::HandleMontageInterrupted()
+{
+	EndAbility(CurrentSpecHandle, CurrentActorInfo, CurrentActivationInfo, true, true);
+}
+
+void UMythosComboAbility::OpenComboWindow()
+{
+	const FMythosComboStep* StepData = ComboGraph ? ComboGraph->GetStep(CurrentStep) : nullptr;
+	UAbilitySystemComponent* OwnerASC = GetAbilitySystemComponentFromActorInfo();
+	if (StepData && OwnerASC && StepData->WindowTag.IsValid())
+	{
+		ActiveWindowTag = StepData->WindowTag;
+		OwnerASC->AddLooseGameplayTag(ActiveWindowTag);
+	}
+}
+
+void UMythosComboAbility::CloseComboWindow()
+{
+	UAbilitySystemComponent* OwnerASC = GetAbilitySystemComponentFromActorInfo();
+	if (OwnerASC && ActiveWindowTag.IsValid())
+	{
+		OwnerASC->RemoveLooseGameplayTag(ActiveWindowTag);
+	}
+	ActiveWindowTag = FGameplayTag();
+}
+
+void UMythosComboAbility::ClearStep()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(WindowOpenTimer);
+		World->GetTimerManager().ClearTimer(WindowCloseTimer);
+	}
+
+	CloseComboWindow();
+
+	UAbilitySystemComponent* OwnerASC = GetAbilitySystemComponentFromActorInfo();
+	if (OwnerASC && ActiveStepTag.IsValid())
+	{
+		OwnerASC->RemoveLooseGameplayTag(ActiveStepTag);
+	}
+	ActiveStepTag = FGameplayTag();
+}
@@ -0,0 +1,79 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Core/AbilitySystem/Abilities/Base/MythosGameplayAbility.h"
+#include "MythosComboAbility.generated.h"
+
+class UMythosComboGraph;
+struct FMythosComboStep;
+
+/**
+ * Light attack chain driven by a UMythosComboGraph.
+ * Each activation plays one step. Activating again while the step's combo window is open moves
+ * to the step's NextStep, otherwise the chain starts over at step 0. While a step plays with its
+ * window closed the ability refuses to activate, so early presses stay in the ASC input buffer
+ * until the window tag is added.
+ */
+UCLASS()
+class MYTHOS_API UMythosComboAbility : public UMythosGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	UMythosComboAbility();
+
+	virtual bool CanActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayTagContainer* SourceTags = nullptr, const FGameplayTagContainer* TargetTags = nullptr, OUT FGameplayTagContainer* OptionalRelevantTags = nullptr) const override;
+
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
+
+	virtual void EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, bool bReplicateEndAbility, bool bWasCancelled) override;
+
+	// also streams the combo graph's montage
+	virtual void GatherPreloadAssets(TArray<FSoftObjectPath>& OutAssets) const override;
+
+	// chain played by this ability, one asset per weapon type
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo")
+	TObjectPtr<UMythosComboGraph> ComboGraph;
+
+	// step currently playing, INDEX_NONE when no chain is running
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Combo")
+	int32 GetCurrentComboStep() const { return CurrentStep; }
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Combo")
+	bool IsComboWindowOpen() const;
+
+protected:
+	UFUNCTION()
+	void HandleMontageCompleted();
+
+	UFUNCTION()
+	void HandleMontageInterrupted();
+
+	void OpenComboWindow();
+	void CloseComboWindow();
+
+	void ClearStep();
+
+	UFUNCTION(BlueprintImplementableEvent, Category = "Mythos|Combo")
+	void OnComboStepStarted(int32 StepIndex);
+
+private:
+	// Combo progress outlives a single activation (the next step is a new activation),
+	// so it sits on the per-actor instance rather than in FMythosAbilityActivationContext
+	int32 CurrentStep = INDEX_NONE;
+
+	// the last step ended inside its window, the next activation (until WindowCloseTime) plays NextStep
+	bool bAdvanceOnActivate = false;
+
+	// world time window of the current step
+	double WindowOpenTime = 0.0;
+	double WindowCloseTime = 0.0;
+
+	FGameplayTag ActiveStepTag;
+	FGameplayTag ActiveWindowTag;
+
+	FTimerHandle WindowOpenTimer;
+	FTimerHandle WindowCloseTimer;
+};
@@ -0,0 +1,45 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AbilitySystem/Abilities/Combo/MythosComboGraph.h"
+#include "Animation/AnimMontage.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+
+#define LOCTEXT_NAMESPACE "MythosComboGraph"
+
+EDataValidationResult UMythosComboGraph::IsDataValid(FDataValidationContext& Context) const
+{
+	EDataValidationResult Result = Super::IsDataValid(Context);
+	const UAnimMontage* Montage = ComboMontage.LoadSynchronous();
+
+	for (int32 Index = 0; Index < Steps.Num(); ++Index)
+	{
+		const FMythosComboStep& Step = Steps[Index];
+
+		if (Step.NextStep != INDEX_NONE && !Steps.IsValidIndex(Step.NextStep))
+		{
+			Context.AddError(FText::Format(LOCTEXT("InvalidNextStep", "Step {0} points to missing step {1}"), Index, Step.NextStep));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		if (Step.WindowEnd < Step.WindowStart)
+		{
+			Context.AddError(FText::Format(LOCTEXT("InvalidWindow", "Step {0} closes its combo window before opening it"), Index));
+			Result = EDataValidationResult::Invalid;
+		}
+
+		if (Montage && !Montage->IsValidSectionName(Step.MontageSection))
+		{
+			Context.AddError(FText::Format(LOCTEXT("MissingSection", "Step {0} uses section {1} which {2} does not have"),
+				Index, FText::FromName(Step.MontageSection), FText::FromString(Montage->GetName())));
+			Result = EDataValidationResult::Invalid;
+		}
+	}
+
+	return Result;
+}
+
+#undef LOCTEXT_NAMESPACE
+#endif
@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "GameplayTagContainer.h"
+#include "MythosComboGraph.generated.h"
+
+class UAnimMontage;
+
+/**
+ * One attack of a combo chain
+ * window times are seconds from the start of the step's montage section
+ */
+USTRUCT(BlueprintType)
+struct FMythosComboStep
+{
+	GENERATED_BODY()
+
+	// montage section played for this attack
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo")
+	FName MontageSection;
+
+	// added to the owner while the step plays, e.g. LightAttack.2
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo")
+	FGameplayTag StepTag;
+
+	// added while the window is open, e.g. LightAttack.ComboWindow.2
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo")
+	FGameplayTag WindowTag;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo", meta = (ClampMin = "0.0"))
+	float WindowStart = 0.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo", meta = (ClampMin = "0.0"))
+	float WindowEnd = 0.0f;
+
+	// step entered when the input lands in the window, INDEX_NONE ends the chain
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo")
+	int32 NextStep = INDEX_NONE;
+};
+
+/**
+ * Light attack chain of one weapon type.
+ * Steps are a flat array and transitions are indices into it, so advancing the combo is a table lookup.
+ * Step 0 is the opener.
+ */
+UCLASS(BlueprintType)
+class MYTHOS_API UMythosComboGraph : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	// weapon this chain belongs to, e.g. Equipment.Weapon.TwoHanded.Spear
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo")
+	FGameplayTag WeaponTag;
+
+	// montage holding one section per step, streamed in when the combo ability is granted
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo", meta = (AssetBundles = "Ability"))
+	TSoftObjectPtr<UAnimMontage> ComboMontage;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Combo")
+	TArray<FMythosComboStep> Steps;
+
+	const FMythosComboStep* GetStep(int32 StepIndex) const
+	{
+		return Steps.IsValidIndex(StepIndex) ? &Steps[StepIndex] : nullptr;
+	}
+
+	// Step that follows StepIndex, INDEX_NONE if the chain ends there
+	int32 GetNextStep(int32 StepIndex) const
+	{
+		return Steps.IsValidIndex(StepIndex) && Steps.IsValidIndex(Steps[StepIndex].NextStep) ? Steps[StepIndex].NextStep : INDEX_NONE;
+	}
+
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#endif
+};
@@ -0,0 +1,40 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AbilitySystem/Animation/MythosAnimNotifyState_WeaponTrace.h"
+#include "Core/AbilitySystem/Tags/MythosGameplayTags.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+UMythosAnimNotifyState_WeaponTrace::UMythosAnimNotifyState_WeaponTrace()
+{
+	Settings.EventTag = MythosGameplayTags::CharacterAbility_WeaponSkill_Spear_LightAttack_TraceEnemy;
+}
+
+void UMythosAnimNotifyState_WeaponTrace::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference)
+{
+	Super::NotifyBegin(MeshComp, Animation, TotalDuration, EventReference);
+
+	// No subsystem in animation preview worlds
+	UWorld* World = MeshComp ? MeshComp->GetWorld() : nullptr;
+	if (UMythosWeaponTraceSubsystem* TraceSubsystem = World ? World->GetSubsystem<UMythosWeaponTraceSubsystem>() : nullptr)
+	{
+		TraceSubsystem->BeginSwing(MeshComp, this, Settings);
+	}
+}
+
+void UMythosAnimNotifyState_WeaponTrace::NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference)
+{
+	UWorld* World = MeshComp ? MeshComp->GetWorld() : nullptr;
+	if (UMythosWeaponTraceSubsystem* TraceSubsystem = World ? World->GetSubsystem<UMythosWeaponTraceSubsystem>() : nullptr)
+	{
+		TraceSubsystem->EndSwing(MeshComp, this);
+	}
+
+	Super::NotifyEnd(MeshComp, Animation, EventReference);
+}
+
+FString UMythosAnimNotifyState_WeaponTrace::GetNotifyName_Implementation() const
+{
+	return TEXT("Weapon Trace");
+}
@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimNotifies/AnimNotifyState.h"
+#include "Core/Subsystem/MythosWeaponTraceSubsystem.h"
+#include "MythosAnimNotifyState_WeaponTrace.generated.h"
+
+/**
+ * Traces the weapon for the length of the notify and sends EventTag to the owner for each actor hit.
+ * The tracing itself is done by UMythosWeaponTraceSubsystem.
+ */
+UCLASS(meta = (DisplayName = "Mythos Weapon Trace"))
+class MYTHOS_API UMythosAnimNotifyState_WeaponTrace : public UAnimNotifyState
+{
+	GENERATED_BODY()
+
+public:
+	UMythosAnimNotifyState_WeaponTrace();
+
+	virtual void NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration, const FAnimNotifyEventReference& EventReference) override;
+	virtual void NotifyEnd(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, const FAnimNotifyEventReference& EventReference) override;
+	virtual FString GetNotifyName_Implementation() const override;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|WeaponTrace")
+	FMythosWeaponTraceSettings Settings;
+};
@@ -0,0 +1,14 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AbilitySystem/Character/MythosEnemyArchetype.h"
+#include "Core/AbilitySystem/Component/MythosAttributeSet.h"
+
+UMythosEnemyArchetype::UMythosEnemyArchetype()
+{
+	MaxAttributes = {
+		UMythosAttributeSet::GetMaxHealthAttribute(),
+		UMythosAttributeSet::GetMaxManaAttribute(),
+		UMythosAttributeSet::GetMaxStaminaAttribute()
+	};
+}
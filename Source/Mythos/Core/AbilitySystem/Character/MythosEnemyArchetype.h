@@ -0,0 +1,60 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "AttributeSet.h"
+#include "AbilitySystemComponent.h"
+#include "MythosEnemyArchetype.generated.h"
+
+class UGameplayAbility;
+
+/**
+ * Attribute value an archetype starts with, overrides the attribute set default
+ */
+USTRUCT(BlueprintType)
+struct FMythosAttributeDefault
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Enemy")
+	FGameplayAttribute Attribute;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Enemy")
+	float Value = 0.0f;
+};
+
+/**
+ * Data that makes an enemy "this kind of enemy": granted abilities and starting attributes.
+ * Pooled enemies are reset to their archetype when they are reused.
+ */
+UCLASS(BlueprintType)
+class MYTHOS_API UMythosEnemyArchetype : public UDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UMythosEnemyArchetype();
+
+	// abilities granted when an enemy takes this archetype
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Enemy")
+	TArray<TSubclassOf<UGameplayAbility>> DefaultAbilities;
+
+	// starting attribute values, anything not listed uses the attribute set default
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Enemy")
+	TArray<FMythosAttributeDefault> AttributeDefaults;
+
+	// attributes that cap others (MaxHealth caps Health), written first on a reset so the current
+	// values are not clamped against the previous archetype's maximum
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Enemy")
+	TArray<FGameplayAttribute> MaxAttributes;
+
+	// use ReplicationMode instead of the enemy class default
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Enemy|Network")
+	bool bOverrideReplicationMode = false;
+
+	// e.g. Mixed for bosses whose effects the UI has to show
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Enemy|Network", meta = (EditCondition = "bOverrideReplicationMode"))
+	EGameplayEffectReplicationMode ReplicationMode = EGameplayEffectReplicationMode::Minimal;
+};
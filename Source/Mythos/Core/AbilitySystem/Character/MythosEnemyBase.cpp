@@ -3,6 +3,41 @@
 #include "MythosEnemyBase.h"
 #include "GameFramework/CharacterMovementComponent.h"
 #include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
+#include "Core/AbilitySystem/Character/MythosEnemyArchetype.h"
+#include "Core/AbilitySystem/Tags/MythosGameplayTags.h"
+#include "Core/Subsystem/MythosAttackTokenSubsystem.h"
+#include "Core/Subsystem/MythosThreatSubsystem.h"
+#include "Core/Subsystem/MythosAISchedulerSubsystem.h"
+#include "Core/Subsystem/MythosEnemyAbilityBatchSubsystem.h"
+#include "Components/CapsuleComponent.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+
+static TAutoConsoleVariable<bool> CVarMythosLegacyEnemyReplication(
+	TEXT("Mythos.Net.LegacyEnemyReplication"),
+	false,
+	TEXT("Replicate enemies like players (Mixed ASC replication, never dormant), used to compare net stats. Applies to live enemies right away."),
+	FConsoleVariableDelegate::CreateLambda([](IConsoleVariable*)
+	{
+		for (TObjectIterator<AMythosEnemyBase> It(RF_ClassDefaultObject, true, EInternalObjectFlags::Garbage); It; ++It)
+		{
+			if (It->GetWorld() && !It->IsInPool())
+			{
+				It->ApplyNetReplicationSettings();
+			}
+		}
+	}),
+	ECVF_Default);
+
+AMythosEnemyBase::AMythosEnemyBase()
+{
+	// AI enemies only need tags and cues replicated, not their full active effect list
+	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Minimal);
+	NetDormancy = DORM_Awake;
+	TargetFilter = MythosGameplayTags::CharacterType_Player;
+}
 
 void AMythosEnemyBase::UpdateMaxWalkSpeed(float NewMaxWalkSpeed)
 {
@@ -12,13 +47,502 @@ void AMythosEnemyBase::UpdateMaxWalkSpeed(float NewMaxWalkSpeed)
 	}
 }
 
+void AMythosEnemyBase::PostInitializeComponents()
+{
+	Super::PostInitializeComponents();
+
+	if (AbilitySystemComponent)
+	{
+		AbilitySystemComponent->SetReplicationMode(GetDesiredReplicationMode());
+	}
+
+	if (AttributeSet)
+	{
+		AttributeSet->OnHealthChanged.AddDynamic(this, &AMythosEnemyBase::HandleEnemyHealthChanged);
+	}
+
+	if (AbilitySystemComponent)
+	{
+		AbilitySystemComponent->AbilityActivatedCallbacks.AddUObject(this, &AMythosEnemyBase::HandleAbilityActivated);
+		AbilitySystemComponent->OnAbilityEnded.AddUObject(this, &AMythosEnemyBase::HandleAbilityEnded);
+	}
+}
+
+void AMythosEnemyBase::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Enemies placed in the level take their default archetype, the pool sets its archetype before spawning finishes
+	if (HasAuthority() && Archetype && !GrantedArchetype)
+	{
+		ApplyArchetype(Archetype);
+	}
+
+	if (UMythosEnemySignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UMythosEnemySignificanceSubsystem>())
+	{
+		Significance->RegisterEnemy(this);
+	}
+
+	StartScheduledAI();
+}
+
+void AMythosEnemyBase::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UMythosEnemySignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UMythosEnemySignificanceSubsystem>())
+	{
+		Significance->UnregisterEnemy(this);
+	}
+
+	StopScheduledAI();
+
+	if (UMythosAttackTokenSubsystem* Tokens = GetWorld()->GetSubsystem<UMythosAttackTokenSubsystem>())
+	{
+		Tokens->ReleaseToken(this);
+	}
+
+	if (UMythosThreatSubsystem* Threat = GetWorld()->GetSubsystem<UMythosThreatSubsystem>())
+	{
+		Threat->UnregisterEnemy(this);
+	}
+	ThreatTable.Reset();
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMythosEnemyBase::NotifyCombatActivity()
+{
+	// Wake up so the damage / cast actually reaches clients
+	if (HasAuthority() && NetDormancy != DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+
+	if (UMythosEnemySignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UMythosEnemySignificanceSubsystem>())
+	{
+		Significance->PromoteEnemy(this);
+	}
+}
+
+void AMythosEnemyBase::NotifyAggro()
+{
+	NotifyCombatActivity();
+}
+
+void AMythosEnemyBase::RunScheduledAIUpdate(float TimeSinceLastUpdate)
+{
+	if (bInPool)
+	{
+		return;
+	}
+
+	// The controller's brain (StateTree) is the enemy's AI, the scheduler only decides when it runs
+	if (UBrainComponent* Brain = GetBrain())
+	{
+		if (Brain->IsRunning())
+		{
+			Brain->TickComponent(TimeSinceLastUpdate, LEVELTICK_All, nullptr);
+		}
+
+		// Starting logic or scheduling its next tick can turn the component tick back on
+		Brain->SetComponentTickEnabled(false);
+		return;
+	}
+
+	// No brain: built-in perception and ability choice through ChooseAbility
+	UMythosEnemyAbilityBatchSubsystem* Batch = GetWorld()->GetSubsystem<UMythosEnemyAbilityBatchSubsystem>();
+	if (!Batch)
+	{
+		return;
+	}
+
+	// Perception and target selection: whoever has the most threat, else the closest in aggro range
+	AActor* Target = GetTopThreatTarget();
+	float Distance = 0.0f;
+	if (Target)
+	{
+		Distance = FVector::Dist(GetActorLocation(), Target->GetActorLocation());
+	}
+	else
+	{
+		Target = Batch->FindNearestTarget(this, TargetFilter, AggroRange, &Distance);
+	}
+
+	if (Target != ScheduledTarget.Get())
+	{
+		ScheduledTarget = Target;
+		if (Target)
+		{
+			NotifyAggro();
+		}
+	}
+
+	// Ability choice, one request in flight at a time
+	if (ScheduledAbilityRequest != INDEX_NONE)
+	{
+		if (Batch->GetRequestStatus(ScheduledAbilityRequest) == EMythosAbilityRequestStatus::Pending)
+		{
+			return;
+		}
+		Batch->ReleaseRequest(ScheduledAbilityRequest);
+		ScheduledAbilityRequest = INDEX_NONE;
+	}
+
+	if (Target)
+	{
+		const FGameplayTag AbilityTag = ChooseAbility(Target, Distance);
+		if (AbilityTag.IsValid())
+		{
+			ScheduledAbilityRequest = Batch->RequestAbility(this, AbilityTag, TargetFilter, FMath::Max(Distance, AbilityRange), Target);
+		}
+	}
+}
+
+FGameplayTag AMythosEnemyBase::ChooseAbility_Implementation(AActor* Target, float Distance)
+{
+	return Distance <= AbilityRange ? DefaultAbilityTag : FGameplayTag();
+}
+
+void AMythosEnemyBase::StartScheduledAI()
+{
+	if (!bUseScheduledAI || !HasAuthority() || bScheduledAIRegistered)
+	{
+		return;
+	}
+
+	UMythosAISchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UMythosAISchedulerSubsystem>();
+	if (!Scheduler)
+	{
+		return;
+	}
+
+	Scheduler->RegisterEnemy(this);
+	bScheduledAIRegistered = true;
+
+	// From here on the brain only runs inside the scheduler's budget
+	if (UBrainComponent* Brain = GetBrain())
+	{
+		Brain->SetComponentTickEnabled(false);
+	}
+}
+
+void AMythosEnemyBase::StopScheduledAI()
+{
+	if (bScheduledAIRegistered)
+	{
+		if (UMythosAISchedulerSubsystem* Scheduler = GetWorld()->GetSubsystem<UMythosAISchedulerSubsystem>())
+		{
+			Scheduler->UnregisterEnemy(this);
+		}
+		bScheduledAIRegistered = false;
+
+		if (UBrainComponent* Brain = GetBrain())
+		{
+			Brain->SetComponentTickEnabled(true);
+		}
+	}
+
+	if (ScheduledAbilityRequest != INDEX_NONE)
+	{
+		if (UMythosEnemyAbilityBatchSubsystem* Batch = GetWorld()->GetSubsystem<UMythosEnemyAbilityBatchSubsystem>())
+		{
+			Batch->ReleaseRequest(ScheduledAbilityRequest);
+		}
+		ScheduledAbilityRequest = INDEX_NONE;
+	}
+	ScheduledTarget.Reset();
+}
+
+UBrainComponent* AMythosEnemyBase::GetBrain() const
+{
+	const AAIController* AIController = Cast<AAIController>(GetController());
+	return AIController ? AIController->GetBrainComponent() : nullptr;
+}
+
+void AMythosEnemyBase::UpdateNetDormancy(float WorldTime)
+{
+	if (!HasAuthority() || bInPool || !bAllowNetDormancy || CVarMythosLegacyEnemyReplication.GetValueOnGameThread())
+	{
+		return;
+	}
+
+	const bool bIdle = GetVelocity().IsNearlyZero() && WorldTime - LastCombatTime >= NetDormancyDelay;
+	if (bIdle && NetDormancy == DORM_Awake)
+	{
+		SetNetDormancy(DORM_DormantAll);
+	}
+	else if (!bIdle && NetDormancy != DORM_Awake)
+	{
+		// started moving again (patrol, knockback)
+		SetNetDormancy(DORM_Awake);
+	}
+}
+
+void AMythosEnemyBase::ApplyNetReplicationSettings()
+{
+	if (!HasAuthority() || !AbilitySystemComponent)
+	{
+		return;
+	}
+
+	AbilitySystemComponent->SetReplicationMode(GetDesiredReplicationMode());
+
+	// Legacy enemies never go dormant, UpdateNetDormancy puts idle ones back to sleep once it is off again
+	if (CVarMythosLegacyEnemyReplication.GetValueOnGameThread() && NetDormancy != DORM_Awake)
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+}
+
+EGameplayEffectReplicationMode AMythosEnemyBase::GetDesiredReplicationMode() const
+{
+	if (CVarMythosLegacyEnemyReplication.GetValueOnGameThread())
+	{
+		return EGameplayEffectReplicationMode::Mixed;
+	}
+	if (Archetype && Archetype->bOverrideReplicationMode)
+	{
+		return Archetype->ReplicationMode;
+	}
+	return AbilityReplicationMode;
+}
+
+void AMythosEnemyBase::HandleEnemyHealthChanged(float OldHealth, float NewHealth, const FGameplayAttribute& Attribute)
+{
+	if (NewHealth < OldHealth)
+	{
+		NotifyCombatActivity();
+	}
+}
+
+void AMythosEnemyBase::HandleAbilityActivated(UGameplayAbility* Ability)
+{
+	NotifyCombatActivity();
+
+	if (UMythosAttackTokenSubsystem* Tokens = GetWorld()->GetSubsystem<UMythosAttackTokenSubsystem>())
+	{
+		Tokens->NotifyEnemyActivation();
+	}
+}
+
+void AMythosEnemyBase::HandleAbilityEnded(const FAbilityEndedData& EndedData)
+{
+	if (UMythosAttackTokenSubsystem* Tokens = GetWorld()->GetSubsystem<UMythosAttackTokenSubsystem>())
+	{
+		Tokens->ReleaseTokenForAbility(this, EndedData.AbilityThatEnded);
+	}
+}
+
+AActor* AMythosEnemyBase::GetTopThreatTarget()
+{
+	const UMythosThreatSubsystem* Threat = GetWorld()->GetSubsystem<UMythosThreatSubsystem>();
+	return Threat ? ThreatTable.GetTopThreat(GetWorld()->GetTimeSeconds(), Threat->GetDecayHalfLife()) : nullptr;
+}
+
+void AMythosEnemyBase::ApplyArchetype(UMythosEnemyArchetype* NewArchetype)
+{
+	if (NewArchetype)
+	{
+		Archetype = NewArchetype;
+	}
+
+	if (!AbilitySystemComponent || !HasAuthority())
+	{
+		return;
+	}
+
+	ApplyNetReplicationSettings();
+
+	// Abilities are only re-granted when the archetype actually changes
+	if (GrantedArchetype != Archetype)
+	{
+		AbilitySystemComponent->ClearAllAbilities();
+		if (Archetype)
+		{
+			for (const TSubclassOf<UGameplayAbility>& AbilityClass : Archetype->DefaultAbilities)
+			{
+				if (AbilityClass)
+				{
+					AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(AbilityClass, 1, INDEX_NONE, this));
+				}
+			}
+		}
+		GrantedArchetype = Archetype;
+	}
+
+	ResetAbilitySystemState();
+}
+
+void AMythosEnemyBase::ActivateFromPool(const FTransform& Transform, UMythosEnemyArchetype* NewArchetype)
+{
+	bInPool = false;
+	LastCombatTime = -BIG_NUMBER;
+
+	if (HasAuthority())
+	{
+		SetNetDormancy(DORM_Awake);
+	}
+
+	SetActorLocationAndRotation(Transform.GetLocation(), Transform.GetRotation(), false, nullptr, ETeleportType::ResetPhysics);
+	SetActorHiddenInGame(false);
+	SetActorEnableCollision(true);
+	SetActorTickEnabled(true);
+
+	ApplyArchetype(NewArchetype);
+
+	// Reactivate movement
+	if (UCharacterMovementComponent* MovementComponent = GetCharacterMovement())
+	{
+		MovementComponent->Activate(true);
+		MovementComponent->SetMovementMode(MOVE_Walking);
+	}
+
+	// Restart AI
+	if (AAIController* AIController = Cast<AAIController>(GetController()))
+	{
+		if (UBrainComponent* Brain = AIController->GetBrainComponent())
+		{
+			Brain->RestartLogic();
+		}
+	}
+
+	if (UMythosEnemySignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UMythosEnemySignificanceSubsystem>())
+	{
+		Significance->RegisterEnemy(this);
+	}
+
+	StartScheduledAI();
+}
+
+void AMythosEnemyBase::DeactivateForPool()
+{
+	bInPool = true;
+
+	if (UMythosEnemySignificanceSubsystem* Significance = GetWorld()->GetSubsystem<UMythosEnemySignificanceSubsystem>())
+	{
+		Significance->UnregisterEnemy(this);
+	}
+
+	StopScheduledAI();
+
+	if (UMythosAttackTokenSubsystem* Tokens = GetWorld()->GetSubsystem<UMythosAttackTokenSubsystem>())
+	{
+		Tokens->ReleaseToken(this);
+	}
+
+	if (UMythosThreatSubsystem* Threat = GetWorld()->GetSubsystem<UMythosThreatSubsystem>())
+	{
+		Threat->UnregisterEnemy(this);
+	}
+	ThreatTable.Reset();
+
+	// Stop AI
+	if (AAIController* AIController = Cast<AAIController>(GetController()))
+	{
+		AIController->StopMovement();
+		if (UBrainComponent* Brain = AIController->GetBrainComponent())
+		{
+			Brain->StopLogic(TEXT("Returned to pool"));
+		}
+	}
+
+	// Stop movement
+	if (UCharacterMovementComponent* MovementComponent = GetCharacterMovement())
+	{
+		MovementComponent->StopMovementImmediately();
+		MovementComponent->DisableMovement();
+		MovementComponent->Deactivate();
+	}
+
+	StopSmoothRotation();
+
+	if (AbilitySystemComponent)
+	{
+		AbilitySystemComponent->CancelAllAbilities();
+
+		// DoTs and auras would keep ticking and replicating on a hidden enemy
+		if (HasAuthority())
+		{
+			ResetAbilitySystemState();
+		}
+	}
+
+	SetActorHiddenInGame(true);
+	SetActorEnableCollision(false);
+	SetActorTickEnabled(false);
+
+	// Nothing to replicate while pooled, the hidden state goes out with the last update
+	if (HasAuthority())
+	{
+		SetNetDormancy(DORM_DormantAll);
+	}
+}
+
+void AMythosEnemyBase::ResetAbilitySystemState()
+{
+	if (!AbilitySystemComponent || !AttributeSet)
+	{
+		return;
+	}
+
+	// Clear every active effect
+	for (const FActiveGameplayEffectHandle& EffectHandle : AbilitySystemComponent->GetActiveEffects(FGameplayEffectQuery()))
+	{
+		AbilitySystemComponent->RemoveActiveGameplayEffect(EffectHandle);
+	}
+
+	// With the effects gone, everything left in the owned tags is loose
+	FGameplayTagContainer LooseTags;
+	AbilitySystemComponent->GetOwnedGameplayTags(LooseTags);
+	for (const FGameplayTag& Tag : LooseTags)
+	{
+		AbilitySystemComponent->SetLooseGameplayTagCount(Tag, 0);
+	}
+
+	// Collect the attribute values: attribute set defaults, then archetype overrides
+	const UMythosAttributeSet* DefaultSet = GetDefault<UMythosAttributeSet>();
+	TArray<TPair<FGameplayAttribute, float>, TInlineAllocator<32>> Values;
+	for (TFieldIterator<FProperty> It(UMythosAttributeSet::StaticClass()); It; ++It)
+	{
+		if (FGameplayAttribute::IsGameplayAttributeDataProperty(*It))
+		{
+			const FGameplayAttribute Attribute(*It);
+			Values.Emplace(Attribute, Attribute.GetNumericValue(DefaultSet));
+		}
+	}
+	if (Archetype)
+	{
+		for (const FMythosAttributeDefault& Override : Archetype->AttributeDefaults)
+		{
+			if (TPair<FGameplayAttribute, float>* Existing = Values.FindByPredicate([&Override](const TPair<FGameplayAttribute, float>& Pair) { return Pair.Key == Override.Attribute; }))
+			{
+				Existing->Value = Override.Value;
+			}
+		}
+	}
+
+	// The archetype's max attributes first, Health/Mana/Stamina are clamped against them in PreAttributeChange
+	const TArray<FGameplayAttribute>& MaxAttributes = (Archetype ? Archetype.Get() : GetDefault<UMythosEnemyArchetype>())->MaxAttributes;
+	for (int32 Pass = 0; Pass < 2; ++Pass)
+	{
+		for (const TPair<FGameplayAttribute, float>& Pair : Values)
+		{
+			const bool bIsMax = MaxAttributes.Contains(Pair.Key);
+			if (bIsMax == (Pass == 0))
+			{
+				AbilitySystemComponent->SetNumericAttributeBase(Pair.Key, Pair.Value);
+			}
+		}
+	}
+
+	// Restore the character type tag
+	InitializeCharacterTypeTags();
+}
+
 void AMythosEnemyBase::InitializeCharacterTypeTags()
 {
 	if (AbilitySystemComponent)
 	{
 		// Add Enemy tag instead of Player tag
-		FGameplayTag EnemyTag = FGameplayTag::RequestGameplayTag(TEXT("CharacterType.Enemy"));
-		AbilitySystemComponent->AddLooseGameplayTag(EnemyTag);
+		AbilitySystemComponent->AddLooseGameplayTag(MythosGameplayTags::CharacterType_Enemy);
 	}
 }
-
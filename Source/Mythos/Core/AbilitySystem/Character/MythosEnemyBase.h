@@ -5,8 +5,13 @@
 #include "CoreMinimal.h"
 #include "MythosCharacter.h"
 #include "GameplayTags.h"
+#include "Core/Subsystem/MythosEnemySignificanceSubsystem.h"
+#include "Core/AI/MythosThreatTable.h"
 #include "MythosEnemyBase.generated.h"
 
+class UMythosEnemyArchetype;
+class UBrainComponent;
+
 /**
  * Base class for enemy characters in the Mythos game
  */
@@ -16,11 +21,151 @@ class MYTHOS_API AMythosEnemyBase : public AMythosCharacter
 	GENERATED_BODY()
 	
 public:
+	AMythosEnemyBase();
+
 	// Update the character movement's max walk speed
 	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Movement")
 	void UpdateMaxWalkSpeed(float NewMaxWalkSpeed);
 
+	// Current significance bucket, drives tick rates of movement, mesh, ASC and AI
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Significance")
+	EMythosEnemySignificance GetSignificance() const { return Significance; }
+
+	// Mark the enemy as engaged in combat, promotes it to full tick rate immediately
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Significance")
+	void NotifyCombatActivity();
+
+	// Called when the enemy picks a target, wakes it from net dormancy like damage does
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Network")
+	void NotifyAggro();
+
+	// Go dormant once the enemy has been out of combat for long enough (server only)
+	void UpdateNetDormancy(float WorldTime);
+
+	// Replication mode from the archetype override, the class default, or Mixed when legacy replication is forced
+	EGameplayEffectReplicationMode GetDesiredReplicationMode() const;
+
+	// Apply GetDesiredReplicationMode to the ASC, and wake the enemy if legacy replication is forced (server only)
+	void ApplyNetReplicationSettings();
+
+	// Grant the archetype's abilities (only if it changed) and reset attributes, effects and tags
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Pool")
+	void ApplyArchetype(UMythosEnemyArchetype* NewArchetype);
+
+	// Called by UMythosEnemyPoolSubsystem when the enemy is taken out of the pool
+	void ActivateFromPool(const FTransform& Transform, UMythosEnemyArchetype* NewArchetype);
+
+	// Called by UMythosEnemyPoolSubsystem when the enemy is returned to the pool
+	void DeactivateForPool();
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Pool")
+	bool IsInPool() const { return bInPool; }
+
+	// Actor with the most threat, null when the enemy is not fighting anyone
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Threat")
+	AActor* GetTopThreatTarget();
+
+	const FMythosThreatTable& GetThreatTable() const { return ThreatTable; }
+
+	// Run by UMythosAISchedulerSubsystem within its frame budget when bUseScheduledAI is set (server only):
+	// ticks the controller's brain, or without one does target selection and asks ChooseAbility
+	void RunScheduledAIUpdate(float TimeSinceLastUpdate);
+
+	// Target picked by the last scheduled update
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|AI")
+	AActor* GetScheduledTarget() const { return ScheduledTarget.Get(); }
+
 protected:
+	// archetype used when the enemy is placed in the level or spawned without one
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Enemy")
+	TObjectPtr<UMythosEnemyArchetype> Archetype;
+
+	// ASC replication mode for this enemy class, AI only needs Minimal
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mythos|Enemy|Network")
+	EGameplayEffectReplicationMode AbilityReplicationMode = EGameplayEffectReplicationMode::Minimal;
+
+	// let the enemy go net dormant while out of combat
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mythos|Enemy|Network")
+	bool bAllowNetDormancy = true;
+
+	// seconds out of combat before the enemy goes dormant
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mythos|Enemy|Network", meta = (EditCondition = "bAllowNetDormancy", ClampMin = "0.0"))
+	float NetDormancyDelay = 10.0f;
+
+	// update the AI through UMythosAISchedulerSubsystem's frame budget instead of the brain component's own tick
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mythos|Enemy|AI")
+	bool bUseScheduledAI = false;
+
+	// characters with this tag within AggroRange are picked up by the scheduled update of an enemy without a brain
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mythos|Enemy|AI")
+	FGameplayTag TargetFilter;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mythos|Enemy|AI", meta = (ClampMin = "0.0"))
+	float AggroRange = 1500.0f;
+
+	// ability the default ChooseAbility picks once the target is within AbilityRange, empty picks nothing
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mythos|Enemy|AI")
+	FGameplayTag DefaultAbilityTag;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "Mythos|Enemy|AI", meta = (ClampMin = "0.0"))
+	float AbilityRange = 200.0f;
+
+	// Ability to request against the scheduled target, an empty tag requests nothing
+	UFUNCTION(BlueprintNativeEvent, Category = "Mythos|Enemy|AI")
+	FGameplayTag ChooseAbility(AActor* Target, float Distance);
+
+	virtual void PostInitializeComponents() override;
+	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
 	// Override to add Enemy tag instead of Player tag
 	virtual void InitializeCharacterTypeTags() override;
+
+	// damage promotes significance
+	UFUNCTION()
+	void HandleEnemyHealthChanged(float OldHealth, float NewHealth, const FGameplayAttribute& Attribute);
+
+	// casting promotes significance
+	void HandleAbilityActivated(UGameplayAbility* Ability);
+
+	// gives back the attack tokens granted for the ability that ended
+	void HandleAbilityEnded(const FAbilityEndedData& EndedData);
+
+	// Remove active effects and loose tags, restore archetype attributes and the character type tag
+	void ResetAbilitySystemState();
+
+private:
+	friend class UMythosEnemySignificanceSubsystem;
+	friend class UMythosThreatSubsystem;
+	friend class UMythosEnemyPoolSubsystem;
+
+	EMythosEnemySignificance Significance = EMythosEnemySignificance::Critical;
+
+	// world time of the last damage taken or ability cast
+	float LastCombatTime = -BIG_NUMBER;
+
+	// archetype whose abilities are currently granted
+	UPROPERTY(Transient)
+	TObjectPtr<UMythosEnemyArchetype> GrantedArchetype;
+
+	bool bInPool = false;
+
+	// written by UMythosThreatSubsystem from damage and heal executions
+	FMythosThreatTable ThreatTable;
+
+	TWeakObjectPtr<AActor> ScheduledTarget;
+
+	// batch request made by the scheduled update, INDEX_NONE when there is none
+	int32 ScheduledAbilityRequest = INDEX_NONE;
+
+	// registered with UMythosAISchedulerSubsystem, the brain's own tick is off meanwhile
+	bool bScheduledAIRegistered = false;
+
+	// Register with the scheduler if bUseScheduledAI is set (server only)
+	void StartScheduledAI();
+
+	// Unregister from the scheduler, give the brain its tick back and drop the scheduled target and request
+	void StopScheduledAI();
+
+	UBrainComponent* GetBrain() const;
 };
@@ -0,0 +1,101 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AbilitySystem/Component/MythosAbilityEffects.h"
+#include "Core/AbilitySystem/Component/MythosAttributeSet.h"
+#include "Core/AbilitySystem/Component/MythosGEExecutionCalculation.h"
+#include "Core/AbilitySystem/Component/MythosGEHealExecutionCalculation.h"
+#include "UObject/Package.h"
+
+const FName UMythosCooldownEffect::DurationName(TEXT("Mythos.Cooldown.Duration"));
+const FName UMythosCostEffect::MagnitudeName(TEXT("Mythos.Cost.Magnitude"));
+
+UMythosCooldownEffect::UMythosCooldownEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::HasDuration;
+
+	FSetByCallerFloat Duration;
+	Duration.DataName = DurationName;
+	DurationMagnitude = FGameplayEffectModifierMagnitude(Duration);
+}
+
+TSubclassOf<UGameplayEffect> UMythosCostEffect::GetCostEffectClass(const FGameplayAttribute& Attribute)
+{
+	if (Attribute == UMythosAttributeSet::GetManaAttribute())
+	{
+		return UMythosManaCostEffect::StaticClass();
+	}
+	if (Attribute == UMythosAttributeSet::GetStaminaAttribute())
+	{
+		return UMythosStaminaCostEffect::StaticClass();
+	}
+	if (Attribute == UMythosAttributeSet::GetHealthAttribute())
+	{
+		return UMythosHealthCostEffect::StaticClass();
+	}
+	return nullptr;
+}
+
+const UGameplayEffect* UMythosCostEffect::GetFallbackCostEffect(const FGameplayAttribute& Attribute)
+{
+	static TMap<FGameplayAttribute, UGameplayEffect*> FallbackEffects;
+	if (UGameplayEffect* const* Existing = FallbackEffects.Find(Attribute))
+	{
+		return *Existing;
+	}
+
+	UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage(), *FString::Printf(TEXT("MythosCost_%s"), *Attribute.GetName()), RF_Transient);
+	Effect->AddToRoot();
+	Effect->DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat Magnitude;
+	Magnitude.DataName = MagnitudeName;
+
+	FGameplayModifierInfo& Modifier = Effect->Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = Attribute;
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Magnitude);
+
+	FallbackEffects.Add(Attribute, Effect);
+	return Effect;
+}
+
+void UMythosCostEffect::InitCostModifier(const FGameplayAttribute& Attribute)
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+
+	FSetByCallerFloat Magnitude;
+	Magnitude.DataName = MagnitudeName;
+
+	FGameplayModifierInfo& Modifier = Modifiers.AddDefaulted_GetRef();
+	Modifier.Attribute = Attribute;
+	Modifier.ModifierOp = EGameplayModOp::Additive;
+	Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(Magnitude);
+}
+
+UMythosManaCostEffect::UMythosManaCostEffect()
+{
+	InitCostModifier(UMythosAttributeSet::GetManaAttribute());
+}
+
+UMythosStaminaCostEffect::UMythosStaminaCostEffect()
+{
+	InitCostModifier(UMythosAttributeSet::GetStaminaAttribute());
+}
+
+UMythosHealthCostEffect::UMythosHealthCostEffect()
+{
+	InitCostModifier(UMythosAttributeSet::GetHealthAttribute());
+}
+
+UMythosDamageEffect::UMythosDamageEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+	Executions.AddDefaulted_GetRef().CalculationClass = UMythosGEExecutionCalculation::StaticClass();
+}
+
+UMythosHealEffect::UMythosHealEffect()
+{
+	DurationPolicy = EGameplayEffectDurationType::Instant;
+	Executions.AddDefaulted_GetRef().CalculationClass = UMythosGEHealExecutionCalculation::StaticClass();
+}
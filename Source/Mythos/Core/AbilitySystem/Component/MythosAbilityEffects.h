@@ -0,0 +1,97 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffect.h"
+#include "MythosAbilityEffects.generated.h"
+
+/**
+ * Cooldown applied by UMythosGameplayAbility, the duration is set by caller.
+ * A class rather than a transient GE so the spec can be predicted and replicated.
+ */
+UCLASS()
+class MYTHOS_API UMythosCooldownEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UMythosCooldownEffect();
+
+	// set-by-caller name of the duration
+	static const FName DurationName;
+};
+
+/**
+ * Instant cost applied by UMythosGameplayAbility, one subclass per cost attribute.
+ * The (negative) amount is set by caller.
+ */
+UCLASS(Abstract)
+class MYTHOS_API UMythosCostEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	// set-by-caller name of the amount
+	static const FName MagnitudeName;
+
+	// Cost effect class draining Attribute, null if there is none
+	static TSubclassOf<UGameplayEffect> GetCostEffectClass(const FGameplayAttribute& Attribute);
+
+	// Transient cost effect for attributes without a class, created once per attribute and kept alive.
+	// It has no net path, so only the server applies it.
+	static const UGameplayEffect* GetFallbackCostEffect(const FGameplayAttribute& Attribute);
+
+protected:
+	void InitCostModifier(const FGameplayAttribute& Attribute);
+};
+
+UCLASS()
+class MYTHOS_API UMythosManaCostEffect : public UMythosCostEffect
+{
+	GENERATED_BODY()
+
+public:
+	UMythosManaCostEffect();
+};
+
+UCLASS()
+class MYTHOS_API UMythosStaminaCostEffect : public UMythosCostEffect
+{
+	GENERATED_BODY()
+
+public:
+	UMythosStaminaCostEffect();
+};
+
+UCLASS()
+class MYTHOS_API UMythosHealthCostEffect : public UMythosCostEffect
+{
+	GENERATED_BODY()
+
+public:
+	UMythosHealthCostEffect();
+};
+
+/**
+ * Instant damage through UMythosGEExecutionCalculation, the base amount is the source's Damage attribute.
+ * Used where there is no Blueprint effect, e.g. the combat benchmark abilities.
+ */
+UCLASS()
+class MYTHOS_API UMythosDamageEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UMythosDamageEffect();
+};
+
+// Instant heal through UMythosGEHealExecutionCalculation, same source attributes as the damage effect
+UCLASS()
+class MYTHOS_API UMythosHealEffect : public UGameplayEffect
+{
+	GENERATED_BODY()
+
+public:
+	UMythosHealEffect();
+};
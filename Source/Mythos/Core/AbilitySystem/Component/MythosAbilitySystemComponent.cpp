@@ -2,4 +2,226 @@
 
 
 #include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
+#include "Core/AbilitySystem/Tags/MythosGameplayTags.h"
+#include "Core/AbilitySystem/Abilities/Base/MythosGameplayAbility.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 
+DEFINE_LOG_CATEGORY(LogMythosAbility);
+
+// a few presses are enough, mashing should not queue a whole combo
+static constexpr int32 MaxBufferedInputs = 4;
+
+UMythosAbilitySystemComponent::UMythosAbilitySystemComponent()
+{
+	ComboWindowTags.AddTag(MythosGameplayTags::CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindowStart);
+	ComboWindowTags.AddTag(MythosGameplayTags::CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow);
+	ComboWindowTags.AddTag(MythosGameplayTags::CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindowStart);
+	ComboWindowTags.AddTag(MythosGameplayTags::CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_1);
+	ComboWindowTags.AddTag(MythosGameplayTags::CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_2);
+	ComboWindowTags.AddTag(MythosGameplayTags::CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_3);
+	ComboWindowTags.AddTag(MythosGameplayTags::CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_4);
+}
+
+void UMythosAbilitySystemComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Tag events fire synchronously, so buffered inputs run on the same frame the window opens
+	for (const FGameplayTag& WindowTag : ComboWindowTags)
+	{
+		RegisterGameplayTagEvent(WindowTag, EGameplayTagEventType::NewOrRemoved)
+			.AddUObject(this, &UMythosAbilitySystemComponent::HandleComboWindowTagChanged);
+	}
+}
+
+bool UMythosAbilitySystemComponent::BufferAbilityActivation(FGameplayTag AbilityTag)
+{
+	if (!AbilityTag.IsValid())
+	{
+		return false;
+	}
+
+	// Nothing in the way, activate right now
+	if (TryActivateAbilitiesByTag(FGameplayTagContainer(AbilityTag)))
+	{
+		return true;
+	}
+
+	if (BufferedInputs.Num() >= MaxBufferedInputs)
+	{
+		BufferedInputs.RemoveAt(0, 1, EAllowShrinking::No);
+	}
+
+	FMythosBufferedAbilityInput& Input = BufferedInputs.AddDefaulted_GetRef();
+	Input.AbilityTag = AbilityTag;
+	Input.Timestamp = GetWorld()->GetTimeSeconds();
+	return false;
+}
+
+void UMythosAbilitySystemComponent::ClearAbilityInputBuffer()
+{
+	BufferedInputs.Reset();
+}
+
+void UMythosAbilitySystemComponent::HandleComboWindowTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	// Only the opening edge of a window matters
+	if (NewCount > 0 && BufferedInputs.Num() > 0)
+	{
+		FlushBufferedInputs();
+	}
+}
+
+void UMythosAbilitySystemComponent::FlushBufferedInputs()
+{
+	if (bFlushingBufferedInputs)
+	{
+		return;
+	}
+	TGuardValue<bool> FlushGuard(bFlushingBufferedInputs, true);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+	BufferedInputs.RemoveAll([this, Now](const FMythosBufferedAbilityInput& Input) { return Now - Input.Timestamp > InputBufferWindow; });
+
+	for (int32 Index = 0; Index < BufferedInputs.Num(); ++Index)
+	{
+		// Copied, activation may buffer new presses and move the array
+		const FMythosBufferedAbilityInput Input = BufferedInputs[Index];
+
+		// One buffered press advances the combo one step, only that press is used up
+		if (TryActivateAbilitiesByTag(FGameplayTagContainer(Input.AbilityTag)))
+		{
+			const int32 FiredIndex = BufferedInputs.IndexOfByPredicate([&Input](const FMythosBufferedAbilityInput& Other)
+			{
+				return Other.AbilityTag == Input.AbilityTag && Other.Timestamp == Input.Timestamp;
+			});
+			if (FiredIndex != INDEX_NONE)
+			{
+				BufferedInputs.RemoveAt(FiredIndex, 1, EAllowShrinking::No);
+			}
+			break;
+		}
+	}
+}
+
+void UMythosAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	LLM_SCOPE_BYTAG(Mythos_AbilitySystem);
+	Super::OnGiveAbility(AbilitySpec);
+
+	// Granting is equipping, start streaming now so activation finds everything loaded
+	if (TSharedPtr<FStreamableHandle> Handle = RequestAbilityAssets(AbilitySpec.Ability))
+	{
+		AbilityAssetHandles.Add(AbilitySpec.Handle, Handle);
+	}
+
+	// The grant holds the assets now, the warm-up can let go
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+	if (AbilitySpec.Ability && PreloadHandles.RemoveAndCopyValue(TObjectKey<UClass>(AbilitySpec.Ability->GetClass()), PreloadHandle) && PreloadHandle.IsValid())
+	{
+		PreloadHandle->ReleaseHandle();
+	}
+}
+
+void UMythosAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	TSharedPtr<FStreamableHandle> Handle;
+	if (AbilityAssetHandles.RemoveAndCopyValue(AbilitySpec.Handle, Handle) && Handle.IsValid())
+	{
+		Handle->ReleaseHandle();
+	}
+
+	Super::OnRemoveAbility(AbilitySpec);
+}
+
+void UMythosAbilitySystemComponent::PreloadAbilityAssets(const TArray<TSubclassOf<UGameplayAbility>>& AbilityClasses)
+{
+	// Each warm-up is kept until OnGiveAbility takes over, a later call must not drop earlier ones
+	for (const TSubclassOf<UGameplayAbility>& AbilityClass : AbilityClasses)
+	{
+		if (!AbilityClass || PreloadHandles.Contains(TObjectKey<UClass>(AbilityClass.Get())))
+		{
+			continue;
+		}
+
+		if (TSharedPtr<FStreamableHandle> Handle = RequestAbilityAssets(AbilityClass.GetDefaultObject()))
+		{
+			PreloadHandles.Add(TObjectKey<UClass>(AbilityClass.Get()), Handle);
+		}
+	}
+}
+
+TSharedPtr<FStreamableHandle> UMythosAbilitySystemComponent::RequestAbilityAssets(const UGameplayAbility* Ability) const
+{
+	const UMythosGameplayAbility* MythosAbility = Cast<UMythosGameplayAbility>(Ability);
+	if (!MythosAbility)
+	{
+		return nullptr;
+	}
+
+	TArray<FSoftObjectPath> Assets;
+	MythosAbility->GatherPreloadAssets(Assets);
+
+	// A dedicated server still plays montages (root motion, notifies) but never sounds or particles
+	if (IsRunningDedicatedServer())
+	{
+		const FSoftObjectPath SoundPath = MythosAbility->AbilitySound.ToSoftObjectPath();
+		const FSoftObjectPath EffectPath = MythosAbility->AbilityEffect.ToSoftObjectPath();
+		Assets.RemoveAll([&SoundPath, &EffectPath](const FSoftObjectPath& Path)
+		{
+			return Path == SoundPath || Path == EffectPath;
+		});
+	}
+	if (Assets.Num() == 0)
+	{
+		return nullptr;
+	}
+
+	return UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(Assets), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+}
+
+static FAutoConsoleCommand MythosAbilityAssetReportCommand(
+	TEXT("Mythos.Ability.AssetReport"),
+	TEXT("Log how many ability presentation assets are resident, their size and the process memory, to compare soft and hard references."),
+	FConsoleCommandDelegate::CreateLambda([]()
+	{
+		int32 NumAbilities = 0;
+		int32 NumReferenced = 0;
+		int32 NumResident = 0;
+		int64 ResidentBytes = 0;
+		TSet<const UObject*> Counted;
+
+		for (TObjectIterator<UClass> It; It; ++It)
+		{
+			if (!It->IsChildOf(UMythosGameplayAbility::StaticClass()) || It->HasAnyClassFlags(CLASS_Abstract))
+			{
+				continue;
+			}
+			++NumAbilities;
+
+			TArray<FSoftObjectPath> Assets;
+			It->GetDefaultObject<UMythosGameplayAbility>()->GatherPreloadAssets(Assets);
+			for (const FSoftObjectPath& Path : Assets)
+			{
+				++NumReferenced;
+				const UObject* Asset = Path.ResolveObject();
+				if (Asset && !Counted.Contains(Asset))
+				{
+					Counted.Add(Asset);
+					++NumResident;
+					ResidentBytes += const_cast<UObject*>(Asset)->GetResourceSizeBytes(EResourceSizeMode::Exclusive);
+				}
+			}
+		}
+
+		const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+		UE_LOG(LogMythosAbility, Log, TEXT("==== Mythos ability asset report ===="));
+		UE_LOG(LogMythosAbility, Log, TEXT("Time since start: %.2fs"), FPlatformTime::Seconds() - GStartTime);
+		UE_LOG(LogMythosAbility, Log, TEXT("Ability classes loaded: %d, asset references: %d"), NumAbilities, NumReferenced);
+		UE_LOG(LogMythosAbility, Log, TEXT("Resident: %d assets, %.2f MB"), NumResident, ResidentBytes / (1024.0 * 1024.0));
+		UE_LOG(LogMythosAbility, Log, TEXT("Process used physical: %.1f MB"), MemoryStats.UsedPhysical / (1024.0 * 1024.0));
+	}));
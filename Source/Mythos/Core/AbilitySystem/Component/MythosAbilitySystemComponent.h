@@ -6,6 +6,26 @@
 #include "AbilitySystemComponent.h"
 #include "MythosAbilitySystemComponent.generated.h"
 
+struct FStreamableHandle;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMythosAbility, Log, All);
+
+/**
+ * Ability activation that was requested before it could run
+ */
+USTRUCT()
+struct FMythosBufferedAbilityInput
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	FGameplayTag AbilityTag;
+
+	// world time the input was pressed
+	UPROPERTY()
+	double Timestamp = 0.0;
+};
+
 /**
  * 
  */
@@ -13,5 +33,64 @@ UCLASS()
 class MYTHOS_API UMythosAbilitySystemComponent : public UAbilitySystemComponent
 {
 	GENERATED_BODY()
-	
+
+public:
+	UMythosAbilitySystemComponent();
+
+	/**
+	 * Try to activate the abilities matching AbilityTag; if that fails (e.g. the previous attack is still
+	 * playing) the request is buffered and fired on the frame a combo window tag is added,
+	 * as long as it is younger than InputBufferWindow.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Ability|Input")
+	bool BufferAbilityActivation(FGameplayTag AbilityTag);
+
+	// Drop every buffered request
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Ability|Input")
+	void ClearAbilityInputBuffer();
+
+	// Stream in the presentation assets of these abilities, e.g. a loadout about to be equipped.
+	// Granted abilities are preloaded automatically, this is for warming up ahead of time.
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Ability|Assets")
+	void PreloadAbilityAssets(const TArray<TSubclassOf<UGameplayAbility>>& AbilityClasses);
+
+	// seconds a buffered input stays valid
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mythos|Ability|Input", meta = (ClampMin = "0.0"))
+	float InputBufferWindow = 0.2f;
+
+	// tags that open a combo window, buffered inputs fire when one of them is added
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|Ability|Input")
+	FGameplayTagContainer ComboWindowTags;
+
+	// the server rejected one of this client's predicted activations
+	FSimpleMulticastDelegate OnAbilityPredictionRejected;
+
+protected:
+	virtual void BeginPlay() override;
+
+	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+
+	// Async load the ability's soft assets, the handle keeps them resident until released
+	TSharedPtr<FStreamableHandle> RequestAbilityAssets(const UGameplayAbility* Ability) const;
+
+	void HandleComboWindowTagChanged(const FGameplayTag Tag, int32 NewCount);
+
+	// Fire the oldest buffered input that activates, drop expired ones and keep the rest for the next window
+	void FlushBufferedInputs();
+
+private:
+	// pressed inputs, oldest first
+	UPROPERTY()
+	TArray<FMythosBufferedAbilityInput> BufferedInputs;
+
+	// activation can open a combo window and re-enter FlushBufferedInputs
+	bool bFlushingBufferedInputs = false;
+
+	// loaded assets of granted abilities, released when the ability is removed
+	TMap<FGameplayAbilitySpecHandle, TSharedPtr<FStreamableHandle>> AbilityAssetHandles;
+
+	// loads requested through PreloadAbilityAssets, held until the ability is granted and takes its own handle;
+	// not a UPROPERTY, so keyed by TObjectKey which stays safe if the class goes away
+	TMap<TObjectKey<UClass>, TSharedPtr<FStreamableHandle>> PreloadHandles;
 };
@@ -3,6 +3,9 @@
 #include "GameplayEffectExtension.h"
 #include "GameplayEffectTypes.h"
 #include "AbilitySystemBlueprintLibrary.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosTrace.h"
+#include "Core/Debug/MythosDebug.h"
 
 UMythosAttributeSet::UMythosAttributeSet()
 {
@@ -28,15 +31,12 @@ UMythosAttributeSet::UMythosAttributeSet()
 
 void UMythosAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data)
 {
+    MYTHOS_SCOPE_STAT(PostGEExecute);
+
     Super::PostGameplayEffectExecute(Data);
     
     // Debug: Check if this function is being called
-    if (GEngine)
-    {
-        FString DebugMessage = FString::Printf(TEXT("PostGameplayEffectExecute called! Attribute: %s, Magnitude: %.2f"), 
-            *Data.EvaluatedData.Attribute.GetName(), Data.EvaluatedData.Magnitude);
-        GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::Blue, DebugMessage);
-    }
+    MYTHOS_DEBUG_MESSAGE(Attributes, 5.0f, FColor::Blue, TEXT("PostGameplayEffectExecute called! Attribute: %s, Magnitude: %.2f"), *Data.EvaluatedData.Attribute.GetName(), Data.EvaluatedData.Magnitude);
 
     FGameplayEffectContextHandle Context = Data.EffectSpec.GetContext();
     UAbilitySystemComponent* SourceASC = Context.GetOriginalInstigatorAbilitySystemComponent();
@@ -68,14 +68,16 @@ void UMythosAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCall
         float NewHealth = FMath::Clamp(GetHealth() - FinalDamage, 0.0f, GetMaxHealth());
         SetHealth(NewHealth);
         SetDamage(0.0f);
-        if (GEngine)
-        {
-            FString Msg = FString::Printf(TEXT("Damage applied: %.2f, Health now: %.2f"), FinalDamage, NewHealth);
-            GEngine->AddOnScreenDebugMessage(-1, 2.0f, FColor::Green, Msg);
-        }
+        MYTHOS_TRACE(EffectExecuted, Data.EffectSpec.Def, GetOwningActor(), GetHealthAttribute(), -FinalDamage, NewHealth);
+        MYTHOS_DEBUG_MESSAGE(Damage, 2.0f, FColor::Green, TEXT("Damage applied: %.2f, Health now: %.2f"), FinalDamage, NewHealth);
         return;
     }
 
+#if MYTHOS_TRACE_ENABLED
+    // value before this execution, the traced delta includes the damage correction and clamping below
+    const float OldValue = Attribute.GetNumericValue(this) - Magnitude;
+#endif
+
     // Apply complex damage calculations for health changes
     if (Attribute == GetHealthAttribute() && Magnitude < 0.0f)
     {
@@ -97,21 +99,13 @@ void UMythosAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCall
         else
         {
             // If no damage calculation was applied, show this
-            if (GEngine)
-            {
-                FString NoCorrectionMessage = FString::Printf(TEXT("No damage correction applied - using original: %.1f"), FMath::Abs(Magnitude));
-                GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Silver, NoCorrectionMessage);
-            }
+            MYTHOS_DEBUG_MESSAGE(Attributes, 3.0f, FColor::Silver, TEXT("No damage correction applied - using original: %.1f"), FMath::Abs(Magnitude));
         }
     }
     else if (Attribute == GetHealthAttribute())
     {
         // Debug: Show non-damage health changes
-        if (GEngine)
-        {
-            FString HealthDebugMessage = FString::Printf(TEXT("Health change (not damage): %.2f"), Magnitude);
-            GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::White, HealthDebugMessage);
-        }
+        MYTHOS_DEBUG_MESSAGE(Attributes, 3.0f, FColor::White, TEXT("Health change (not damage): %.2f"), Magnitude);
     }
     
     //check they are in the valid range - use direct assignment to avoid triggering PostAttributeChange again
@@ -142,6 +136,8 @@ void UMythosAttributeSet::PostGameplayEffectExecute(const FGameplayEffectModCall
             Stamina.SetCurrentValue(ClampedStamina);
         }
     }
+
+    MYTHOS_TRACE(EffectExecuted, Data.EffectSpec.Def, GetOwningActor(), Attribute, Attribute.GetNumericValue(this) - OldValue, Attribute.GetNumericValue(this));
 }
 
 float UMythosAttributeSet::CalculateDamageWithAttributes(const FGameplayEffectModCallbackData& Data, float BaseDamage)
@@ -192,11 +188,7 @@ float UMythosAttributeSet::CalculateDamageWithAttributes(const FGameplayEffectMo
             // You could trigger a critical hit event here
             // OnCriticalHit.Broadcast(FinalDamage);
             
-            if (GEngine)
-            {
-                FString CriticalMessage = FString::Printf(TEXT("CRITICAL HIT! Damage: %.1f"), FinalDamage);
-                GEngine->AddOnScreenDebugMessage(-1, 3.0f, FColor::Red, CriticalMessage);
-            }
+            MYTHOS_DEBUG_MESSAGE(Damage, 3.0f, FColor::Red, TEXT("CRITICAL HIT! Damage: %.1f"), FinalDamage);
         }
     }
     
@@ -4,8 +4,10 @@
 #include "Core/AbilitySystem/Component/MythosGEExecutionCalculation.h"
 #include "AbilitySystemComponent.h"
 #include "Core/AbilitySystem/Component/MythosAttributeSet.h"
+#include "Core/Subsystem/MythosThreatSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
 #include "GameplayTagContainer.h"
-#include "Engine/Engine.h"
+#include "Core/Debug/MythosDebug.h"
 
 
 struct FMythosDamageStatics
@@ -40,6 +42,10 @@ UMythosGEExecutionCalculation::UMythosGEExecutionCalculation()
 
 void UMythosGEExecutionCalculation::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
+    MYTHOS_SCOPE_STAT(DamageExecution);
+    INC_DWORD_STAT(STAT_MythosGEExecutions);
+    ++FMythosCombatCounters::Get().EffectExecutions;
+
     float Damage = 0.f;
     float AttackPower = 1.f;
     float Defense = 0.f;
@@ -65,13 +71,14 @@ void UMythosGEExecutionCalculation::Execute_Implementation(const FGameplayEffect
     {
         OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(
             UMythosAttributeSet::GetHealthAttribute(), EGameplayModOp::Additive, -FinalDamage));
+
+        // queued, the threat subsystem applies the whole frame's events at once
+        const UAbilitySystemComponent* SourceASC = ExecutionParams.GetSourceAbilitySystemComponent();
+        const UAbilitySystemComponent* TargetASC = ExecutionParams.GetTargetAbilitySystemComponent();
+        UMythosThreatSubsystem::QueueDamageThreat(TargetASC ? TargetASC->GetAvatarActor() : nullptr, SourceASC ? SourceASC->GetAvatarActor() : nullptr, FinalDamage);
     }
 
     // Debug
-    if (GEngine)
-    {
-        FString Msg = FString::Printf(TEXT("Damage!!: %.1f%s"), FinalDamage, bIsCrit ? TEXT(" (CRIT)") : TEXT(""));
-        GEngine->AddOnScreenDebugMessage(-1, 2.0f, bIsCrit ? FColor::Red : FColor::Green, Msg);
-    }
+    MYTHOS_DEBUG_MESSAGE(Damage, 2.0f, bIsCrit ? FColor::Red : FColor::Green, TEXT("Damage!!: %.1f%s"), FinalDamage, bIsCrit ? TEXT(" (CRIT)") : TEXT(""));
 }
 
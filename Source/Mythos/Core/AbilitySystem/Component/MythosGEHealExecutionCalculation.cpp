@@ -2,8 +2,11 @@
 
 
 #include "Core/AbilitySystem/Component/MythosGEHealExecutionCalculation.h"
+#include "AbilitySystemComponent.h"
 #include "Core/AbilitySystem/Component/MythosAttributeSet.h"
-#include "Engine/Engine.h"
+#include "Core/Subsystem/MythosThreatSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Debug/MythosDebug.h"
 
 struct FMythosHealStatics
 {
@@ -34,6 +37,10 @@ UMythosGEHealExecutionCalculation::UMythosGEHealExecutionCalculation()
 
 void UMythosGEHealExecutionCalculation::Execute_Implementation(const FGameplayEffectCustomExecutionParameters& ExecutionParams, FGameplayEffectCustomExecutionOutput& OutExecutionOutput) const
 {
+    MYTHOS_SCOPE_STAT(HealExecution);
+    INC_DWORD_STAT(STAT_MythosGEExecutions);
+    ++FMythosCombatCounters::Get().EffectExecutions;
+
     float Heal = 0.f;
     float HealingPower = 1.f;
     float HealingCritChance = 0.05f;
@@ -57,13 +64,14 @@ void UMythosGEHealExecutionCalculation::Execute_Implementation(const FGameplayEf
     {
         OutExecutionOutput.AddOutputModifier(FGameplayModifierEvaluatedData(
             UMythosAttributeSet::GetHealthAttribute(), EGameplayModOp::Additive, FinalHeal));
+
+        // queued, the threat subsystem applies the whole frame's events at once
+        const UAbilitySystemComponent* SourceASC = ExecutionParams.GetSourceAbilitySystemComponent();
+        const UAbilitySystemComponent* TargetASC = ExecutionParams.GetTargetAbilitySystemComponent();
+        UMythosThreatSubsystem::QueueHealThreat(TargetASC ? TargetASC->GetAvatarActor() : nullptr, SourceASC ? SourceASC->GetAvatarActor() : nullptr, FinalHeal);
     }
 
     // Debug
-    if (GEngine)
-    {
-        FString Msg = FString::Printf(TEXT("Heal: %.1f%s"), FinalHeal, bIsCrit ? TEXT(" (CRIT)") : TEXT(""));
-        GEngine->AddOnScreenDebugMessage(-1, 2.0f, bIsCrit ? FColor::Blue : FColor::Cyan, Msg);
-    }
+    MYTHOS_DEBUG_MESSAGE(Heal, 2.0f, bIsCrit ? FColor::Blue : FColor::Cyan, TEXT("Heal: %.1f%s"), FinalHeal, bIsCrit ? TEXT(" (CRIT)") : TEXT(""));
 }
 
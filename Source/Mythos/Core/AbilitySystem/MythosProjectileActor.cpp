@@ -5,6 +5,9 @@
 #include "GameFramework/ProjectileMovementComponent.h"
 #include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
 #include "MythosCharacter.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosTrace.h"
+#include "Core/Profiling/MythosMemory.h"
 
 // Sets default values
 AMythosProjectileActor::AMythosProjectileActor()
@@ -46,11 +49,31 @@ AMythosProjectileActor::AMythosProjectileActor()
 void AMythosProjectileActor::BeginPlay()
 {
 	Super::BeginPlay();
+
+	bCountedAsLive = true;
+	INC_DWORD_STAT(STAT_MythosLiveProjectiles);
+	++FMythosCombatCounters::Get().ProjectilesSpawned;
+	INC_MEMORY_STAT_BY(STAT_MythosProjectileMemory, GetClass()->GetStructureSize());
+}
+
+void AMythosProjectileActor::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bCountedAsLive)
+	{
+		bCountedAsLive = false;
+		DEC_DWORD_STAT(STAT_MythosLiveProjectiles);
+		++FMythosCombatCounters::Get().ProjectilesDestroyed;
+		DEC_MEMORY_STAT_BY(STAT_MythosProjectileMemory, GetClass()->GetStructureSize());
+	}
+
+	Super::EndPlay(EndPlayReason);
 }
 
 // Called every frame
 void AMythosProjectileActor::Tick(float DeltaTime)
 {
+	MYTHOS_SCOPE_STAT(ProjectileTick);
+
 	Super::Tick(DeltaTime);
 
 	// Update life time
@@ -101,6 +124,11 @@ FVector AMythosProjectileActor::GetMovementDirection() const
 	return MovementDirection;
 }
 
+void AMythosProjectileActor::ReportHit(AActor* HitActor)
+{
+	MYTHOS_TRACE(ProjectileHit, this, HitActor);
+}
+
 void AMythosProjectileActor::DestroyProjectile()
 {
 	bIsAlive = false;
@@ -117,6 +145,8 @@ AMythosProjectileActor* AMythosProjectileActor::SpawnProjectileWithDirection(
 	float LifeTime,
 	float Speed)
 {
+	LLM_SCOPE_BYTAG(Mythos_Projectiles);
+
 	if (!ProjectileClass)
 	{
 		UE_LOG(LogTemp, Warning, TEXT("SpawnProjectileWithDirection: Invalid ProjectileClass"));
@@ -154,6 +184,8 @@ AMythosProjectileActor* AMythosProjectileActor::SpawnProjectileWithDirection(
 		// Set movement direction and fire
 		Projectile->SetMovementDirection(Direction, Speed);
 		Projectile->FireProjectile(Direction, Speed);
+
+		MYTHOS_TRACE(ProjectileSpawned, Projectile, InOwner);
 	}
 
 	return Projectile;
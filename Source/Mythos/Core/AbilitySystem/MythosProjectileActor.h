@@ -22,6 +22,7 @@ public:
 protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 public:	
 	// Called every frame
@@ -51,6 +52,10 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Mythos|Projectile")
 	float GetRemainingLifeTime() const { return RemainingLifeTime; }
 
+	// Call from the Blueprint collision handler so hits show up in the MythosCombat trace
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Projectile")
+	void ReportHit(AActor* HitActor);
+
 	// Destroy projectile
 	UFUNCTION(BlueprintCallable, Category = "Mythos|Projectile")
 	void DestroyProjectile();
@@ -98,4 +103,8 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Mythos|Projectile")
 	float MovementSpeed;
 
+private:
+	// counted as live in BeginPlay; EndPlay also runs for projectiles destroyed before BeginPlay
+	bool bCountedAsLive = false;
+
 };
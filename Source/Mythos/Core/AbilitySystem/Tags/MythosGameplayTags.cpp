@@ -0,0 +1,88 @@
+// Generated from Config/DefaultGameplayTags.ini by Tools/GenerateGameplayTags.py, do not edit by hand.
+// Mythos.Build.cs checks that this list matches the ini.
+
+#include "Core/AbilitySystem/Tags/MythosGameplayTags.h"
+
+namespace MythosGameplayTags
+{
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility, "CharacterAbility", "Character ability system root tag");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_Block, "CharacterAbility.Block", "Block abilities");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill, "CharacterAbility.CommonSkill", "Common skills available to all characters");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Defensive, "CharacterAbility.CommonSkill.Defensive", "Defensive common skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Defensive_Deflect, "CharacterAbility.CommonSkill.Defensive.Deflect", "Deflect defensive skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Defensive_Roll, "CharacterAbility.CommonSkill.Defensive.Roll", "Roll defensive skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Defensive_Shield, "CharacterAbility.CommonSkill.Defensive.Shield", "Shield defensive skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Offensive, "CharacterAbility.CommonSkill.Offensive", "Offensive common skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Utility, "CharacterAbility.CommonSkill.Utility", "Utility common skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Utility_Buff, "CharacterAbility.CommonSkill.Utility.Buff", "Buff utility skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Utility_CC, "CharacterAbility.CommonSkill.Utility.CC", "Crowd control utility skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_CommonSkill_Utility_Reposition, "CharacterAbility.CommonSkill.Utility.Reposition", "Reposition utility skills");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_Parry, "CharacterAbility.Parry", "Parry abilities");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_Shift, "CharacterAbility.Shift", "Movement shift abilities");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_Shift_Blink, "CharacterAbility.Shift.Blink", "Blink shift abilities");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_Shift_Phase, "CharacterAbility.Shift.Phase", "Phase shift abilities");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_Shift_Roll, "CharacterAbility.Shift.Roll", "Roll shift abilities");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill, "CharacterAbility.WeaponSkill", "Weapon-specific skills (Class Skills)");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear, "CharacterAbility.WeaponSkill.Spear", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack, "CharacterAbility.WeaponSkill.Spear.LightAttack", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_1, "CharacterAbility.WeaponSkill.Spear.LightAttack.1", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_2, "CharacterAbility.WeaponSkill.Spear.LightAttack.2", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_3, "CharacterAbility.WeaponSkill.Spear.LightAttack.3", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow, "CharacterAbility.WeaponSkill.Spear.LightAttack.ComboWindow", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow_1, "CharacterAbility.WeaponSkill.Spear.LightAttack.ComboWindow.1", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow_2, "CharacterAbility.WeaponSkill.Spear.LightAttack.ComboWindow.2", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow_3, "CharacterAbility.WeaponSkill.Spear.LightAttack.ComboWindow.3", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindowEnd, "CharacterAbility.WeaponSkill.Spear.LightAttack.ComboWindowEnd", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindowStart, "CharacterAbility.WeaponSkill.Spear.LightAttack.ComboWindowStart", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_Spear_LightAttack_TraceEnemy, "CharacterAbility.WeaponSkill.Spear.LightAttack.TraceEnemy", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield, "CharacterAbility.WeaponSkill.SpearAndShield", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_1, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.1", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_2, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.2", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_3, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.3", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_4, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.4", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_1, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.ComboWindow.1", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_2, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.ComboWindow.2", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_3, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.ComboWindow.3", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_4, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.ComboWindow.4", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindowEnd, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.ComboWindowEnd", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindowStart, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.ComboWindowStart", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_TraceEnemy, "CharacterAbility.WeaponSkill.SpearAndShield.LightAttack.TraceEnemy", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_Movement, "CharacterAbility.WeaponSkill.SpearAndShield.Movement", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterAbility_WeaponSkill_SpearAndShield_Parry, "CharacterAbility.WeaponSkill.SpearAndShield.Parry", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterType, "CharacterType", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterType_Enemy, "CharacterType.Enemy", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(CharacterType_Player, "CharacterType.Player", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(EnemyAbility, "EnemyAbility", "Enemy ability system root tag");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(EnemyAbility_Spear_LightAttack, "EnemyAbility.Spear.LightAttack", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment, "Equipment", "Equipment system root tag");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Armor, "Equipment.Armor", "Armor equipment");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Armor_Boots, "Equipment.Armor.Boots", "Boots");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Armor_Chest, "Equipment.Armor.Chest", "Chest armor");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Armor_Helmet, "Equipment.Armor.Helmet", "Helmets");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon, "Equipment.Weapon", "Weapon equipment");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_Offhand, "Equipment.Weapon.Offhand", "Offhand weapons");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_Offhand_Charms, "Equipment.Weapon.Offhand.Charms", "Charms");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_Offhand_Shields, "Equipment.Weapon.Offhand.Shields", "Shields");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_Offhand_Tomes, "Equipment.Weapon.Offhand.Tomes", "Tomes");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_OneHanded, "Equipment.Weapon.OneHanded", "One-handed weapons");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_OneHanded_Dagger, "Equipment.Weapon.OneHanded.Dagger", "Daggers");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_OneHanded_Sword, "Equipment.Weapon.OneHanded.Sword", "One-handed swords");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_OneHanded_Wands, "Equipment.Weapon.OneHanded.Wands", "Wands");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_TwoHanded, "Equipment.Weapon.TwoHanded", "Two-handed weapons");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_TwoHanded_Greatsword, "Equipment.Weapon.TwoHanded.Greatsword", "Greatswords");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_TwoHanded_Spear, "Equipment.Weapon.TwoHanded.Spear", "Spears");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Equipment_Weapon_TwoHanded_Staves, "Equipment.Weapon.TwoHanded.Staves", "Staves");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State, "State", "Character state system root tag");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Casting, "State.Casting", "Character is casting an ability");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Charging, "State.Charging", "Character is charging an ability");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Invincible, "State.Invincible", "Character is invincible");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Morphed, "State.Morphed", "Character is morphed");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Movement, "State.Movement", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Parry, "State.Parry", "");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Rooted, "State.Rooted", "Character is rooted in place");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Silenced, "State.Silenced", "Character is silenced");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Slow, "State.Slow", "Character is slowed");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Stunned, "State.Stunned", "Character is stunned");
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(State_Unstoppable, "State.Unstoppable", "Character cannot be stopped");
+}
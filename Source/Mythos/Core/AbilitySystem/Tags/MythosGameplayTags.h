@@ -0,0 +1,90 @@
+// Generated from Config/DefaultGameplayTags.ini by Tools/GenerateGameplayTags.py, do not edit by hand.
+// Mythos.Build.cs checks that this list matches the ini.
+
+#pragma once
+
+#include "NativeGameplayTags.h"
+
+namespace MythosGameplayTags
+{
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_Block);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Defensive);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Defensive_Deflect);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Defensive_Roll);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Defensive_Shield);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Offensive);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Utility);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Utility_Buff);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Utility_CC);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_CommonSkill_Utility_Reposition);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_Parry);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_Shift);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_Shift_Blink);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_Shift_Phase);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_Shift_Roll);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_1);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_2);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_3);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow_1);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow_2);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindow_3);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindowEnd);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_ComboWindowStart);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_Spear_LightAttack_TraceEnemy);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_1);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_2);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_3);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_4);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_1);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_2);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_3);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindow_4);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindowEnd);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_ComboWindowStart);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_LightAttack_TraceEnemy);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_Movement);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterAbility_WeaponSkill_SpearAndShield_Parry);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterType);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterType_Enemy);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(CharacterType_Player);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(EnemyAbility);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(EnemyAbility_Spear_LightAttack);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Armor);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Armor_Boots);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Armor_Chest);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Armor_Helmet);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_Offhand);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_Offhand_Charms);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_Offhand_Shields);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_Offhand_Tomes);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_OneHanded);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_OneHanded_Dagger);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_OneHanded_Sword);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_OneHanded_Wands);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_TwoHanded);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_TwoHanded_Greatsword);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_TwoHanded_Spear);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Equipment_Weapon_TwoHanded_Staves);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Casting);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Charging);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Invincible);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Morphed);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Movement);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Parry);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Rooted);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Silenced);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Slow);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Stunned);
+	MYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(State_Unstoppable);
+}
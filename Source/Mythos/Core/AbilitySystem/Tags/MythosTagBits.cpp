@@ -0,0 +1,71 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/AbilitySystem/Tags/MythosTagBits.h"
+#include "Core/AbilitySystem/Tags/MythosGameplayTags.h"
+#include "GameplayTagAssetInterface.h"
+#include "MythosCharacter.h"
+
+namespace MythosTagBits
+{
+	const TArray<FGameplayTag>& GetTrackedTags()
+	{
+		static const TArray<FGameplayTag> TrackedTags = []()
+		{
+			TArray<FGameplayTag> Tags = {
+				MythosGameplayTags::CharacterType,
+				MythosGameplayTags::CharacterType_Enemy,
+				MythosGameplayTags::CharacterType_Player,
+				MythosGameplayTags::State,
+				MythosGameplayTags::State_Casting,
+				MythosGameplayTags::State_Charging,
+				MythosGameplayTags::State_Invincible,
+				MythosGameplayTags::State_Morphed,
+				MythosGameplayTags::State_Movement,
+				MythosGameplayTags::State_Parry,
+				MythosGameplayTags::State_Rooted,
+				MythosGameplayTags::State_Silenced,
+				MythosGameplayTags::State_Slow,
+				MythosGameplayTags::State_Stunned,
+				MythosGameplayTags::State_Unstoppable
+			};
+			check(Tags.Num() <= sizeof(FMask) * 8);
+			return Tags;
+		}();
+		return TrackedTags;
+	}
+
+	FMask GetMask(const FGameplayTag& Tag)
+	{
+		// Few enough tags that a linear scan of FName compares beats hashing
+		const TArray<FGameplayTag>& TrackedTags = GetTrackedTags();
+		for (int32 Bit = 0; Bit < TrackedTags.Num(); ++Bit)
+		{
+			if (TrackedTags[Bit] == Tag)
+			{
+				return FMask(1) << Bit;
+			}
+		}
+		return 0;
+	}
+
+	bool ActorMatchesTag(const AActor* Actor, const FGameplayTag& Tag, FMask TagMask)
+	{
+		if (!Actor)
+		{
+			return false;
+		}
+
+		if (TagMask != 0)
+		{
+			if (const AMythosCharacter* Character = Cast<AMythosCharacter>(Actor))
+			{
+				return Character->HasAnyTagBits(TagMask);
+			}
+		}
+
+		// Untracked tag or non-Mythos actor
+		const IGameplayTagAssetInterface* TagInterface = Cast<IGameplayTagAssetInterface>(Actor);
+		return TagInterface && TagInterface->HasMatchingGameplayTag(Tag);
+	}
+}
@@ -0,0 +1,28 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+
+class AActor;
+
+/**
+ * Compact bitset of the tags hot-path filters test most (CharacterType.*, State.*).
+ * Each AMythosCharacter keeps one of these in sync with its ASC tag counts, so a filter
+ * on a tracked tag is a single AND instead of an interface cast and a tag map lookup.
+ * Parent tags are tracked too, their bit is set while any child tag is present.
+ */
+namespace MythosTagBits
+{
+	using FMask = uint32;
+
+	// All tracked tags, bit N is GetTrackedTags()[N]
+	MYTHOS_API const TArray<FGameplayTag>& GetTrackedTags();
+
+	// Bit for a tracked tag, 0 when the tag is not tracked
+	MYTHOS_API FMask GetMask(const FGameplayTag& Tag);
+
+	// Same result as IGameplayTagAssetInterface::HasMatchingGameplayTag, using the bitset when the tag is tracked
+	MYTHOS_API bool ActorMatchesTag(const AActor* Actor, const FGameplayTag& Tag, FMask TagMask);
+}
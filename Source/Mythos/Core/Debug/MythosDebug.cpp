@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Debug/MythosDebug.h"
+
+#if MYTHOS_DEBUG_ENABLED
+
+#include "Core/Subsystem/MythosDebugDrawSubsystem.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace
+{
+	int32 CategoryEnabled[static_cast<int32>(EMythosDebugCategory::Count)] = { 1, 1, 1, 0 };
+
+	FAutoConsoleVariableRef CVarMythosDebugTargeting(
+		TEXT("Mythos.Debug.Targeting"),
+		CategoryEnabled[static_cast<int32>(EMythosDebugCategory::Targeting)],
+		TEXT("Draw ability target spheres and cones."));
+
+	FAutoConsoleVariableRef CVarMythosDebugDamage(
+		TEXT("Mythos.Debug.Damage"),
+		CategoryEnabled[static_cast<int32>(EMythosDebugCategory::Damage)],
+		TEXT("Show damage and crit messages on screen."));
+
+	FAutoConsoleVariableRef CVarMythosDebugHeal(
+		TEXT("Mythos.Debug.Heal"),
+		CategoryEnabled[static_cast<int32>(EMythosDebugCategory::Heal)],
+		TEXT("Show heal messages on screen."));
+
+	FAutoConsoleVariableRef CVarMythosDebugAttributes(
+		TEXT("Mythos.Debug.Attributes"),
+		CategoryEnabled[static_cast<int32>(EMythosDebugCategory::Attributes)],
+		TEXT("Show every attribute change on screen, verbose."));
+
+	UMythosDebugDrawSubsystem* GetDrawSubsystem(const UObject* WorldContextObject)
+	{
+		const UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+		return World ? World->GetSubsystem<UMythosDebugDrawSubsystem>() : nullptr;
+	}
+}
+
+namespace MythosDebug
+{
+	bool IsEnabled(EMythosDebugCategory Category)
+	{
+		return CategoryEnabled[static_cast<int32>(Category)] != 0;
+	}
+
+	void DrawSphere(const UObject* WorldContextObject, const FVector& Center, float Radius, const FColor& Color, float Duration)
+	{
+		if (UMythosDebugDrawSubsystem* DebugDraw = GetDrawSubsystem(WorldContextObject))
+		{
+			DebugDraw->QueueSphere(Center, Radius, Color, Duration);
+		}
+	}
+
+	void DrawCone(const UObject* WorldContextObject, const FVector& Origin, const FVector& Direction, float Length, float HalfAngleRadians, const FColor& Color, float Duration)
+	{
+		if (UMythosDebugDrawSubsystem* DebugDraw = GetDrawSubsystem(WorldContextObject))
+		{
+			DebugDraw->QueueCone(Origin, Direction, Length, HalfAngleRadians, Color, Duration);
+		}
+	}
+
+	void AddMessage(float Duration, const FColor& Color, const FString& Message)
+	{
+		if (GEngine)
+		{
+			GEngine->AddOnScreenDebugMessage(-1, Duration, Color, Message);
+		}
+	}
+}
+
+#endif
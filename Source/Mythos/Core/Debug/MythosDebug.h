@@ -0,0 +1,78 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Debug draws and on-screen messages exist only in client builds that can draw, Shipping and the Server target compile them out
+#define MYTHOS_DEBUG_ENABLED (ENABLE_DRAW_DEBUG && !UE_SERVER)
+
+/**
+ * Debug categories, each switched by a Mythos.Debug.<Category> console variable
+ */
+enum class EMythosDebugCategory : uint8
+{
+	// ability target sweeps and cones
+	Targeting,
+
+	// damage execution results and crits
+	Damage,
+
+	// heal execution results
+	Heal,
+
+	// every attribute change in PostGameplayEffectExecute
+	Attributes,
+
+	Count
+};
+
+#if MYTHOS_DEBUG_ENABLED
+
+namespace MythosDebug
+{
+	MYTHOS_API bool IsEnabled(EMythosDebugCategory Category);
+
+	// Shapes are queued on the world's UMythosDebugDrawSubsystem and submitted once per frame
+	MYTHOS_API void DrawSphere(const UObject* WorldContextObject, const FVector& Center, float Radius, const FColor& Color, float Duration);
+
+	MYTHOS_API void DrawCone(const UObject* WorldContextObject, const FVector& Origin, const FVector& Direction, float Length, float HalfAngleRadians, const FColor& Color, float Duration);
+
+	MYTHOS_API void AddMessage(float Duration, const FColor& Color, const FString& Message);
+}
+
+// Arguments, including the message format, are only evaluated while the category is on
+#define MYTHOS_DEBUG_SPHERE(Category, WorldContextObject, Center, Radius, Color, Duration) \
+	do \
+	{ \
+		if (MythosDebug::IsEnabled(EMythosDebugCategory::Category)) \
+		{ \
+			MythosDebug::DrawSphere(WorldContextObject, Center, Radius, Color, Duration); \
+		} \
+	} while (0)
+
+#define MYTHOS_DEBUG_CONE(Category, WorldContextObject, Origin, Direction, Length, HalfAngleRadians, Color, Duration) \
+	do \
+	{ \
+		if (MythosDebug::IsEnabled(EMythosDebugCategory::Category)) \
+		{ \
+			MythosDebug::DrawCone(WorldContextObject, Origin, Direction, Length, HalfAngleRadians, Color, Duration); \
+		} \
+	} while (0)
+
+#define MYTHOS_DEBUG_MESSAGE(Category, Duration, Color, Format, ...) \
+	do \
+	{ \
+		if (MythosDebug::IsEnabled(EMythosDebugCategory::Category)) \
+		{ \
+			MythosDebug::AddMessage(Duration, Color, FString::Printf(Format, ##__VA_ARGS__)); \
+		} \
+	} while (0)
+
+#else
+
+#define MYTHOS_DEBUG_SPHERE(Category, WorldContextObject, Center, Radius, Color, Duration) do {} while (0)
+#define MYTHOS_DEBUG_CONE(Category, WorldContextObject, Origin, Direction, Length, HalfAngleRadians, Color, Duration) do {} while (0)
+#define MYTHOS_DEBUG_MESSAGE(Category, Duration, Color, Format, ...) do {} while (0)
+
+#endif
@@ -0,0 +1,20 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Profiling/MythosActorChannel.h"
+#include "Core/Subsystem/MythosNetReportSubsystem.h"
+#include "Engine/NetConnection.h"
+#include "Engine/NetDriver.h"
+#include "Engine/World.h"
+
+FPacketIdRange UMythosActorChannel::SendBunch(FOutBunch* Bunch, bool Merge)
+{
+	if (Bunch && Connection && Connection->Driver)
+	{
+		if (UMythosNetReportSubsystem* Report = UMythosNetReportSubsystem::GetActiveEnemyReport(Connection->Driver->GetWorld()))
+		{
+			Report->RecordActorBunch(Actor ? Actor->GetClass() : nullptr, Bunch->GetNumBits());
+		}
+	}
+	return Super::SendBunch(Bunch, Merge);
+}
@@ -0,0 +1,21 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/ActorChannel.h"
+#include "MythosActorChannel.generated.h"
+
+/**
+ * Actor channel that reports the bunches it sends to UMythosNetReportSubsystem, so the enemy report
+ * can attribute outgoing bytes to actor classes instead of dividing the total by the enemy count.
+ * Registered as the "Actor" channel class in DefaultEngine.ini.
+ */
+UCLASS(Transient)
+class MYTHOS_API UMythosActorChannel : public UActorChannel
+{
+	GENERATED_BODY()
+
+public:
+	virtual FPacketIdRange SendBunch(FOutBunch* Bunch, bool Merge) override;
+};
@@ -0,0 +1,151 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Profiling/MythosMemory.h"
+#include "MythosCharacter.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
+#include "Core/AbilitySystem/MythosProjectileActor.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
+#include "UObject/Package.h"
+
+LLM_DEFINE_TAG(Mythos_AbilitySystem);
+LLM_DEFINE_TAG(Mythos_Effects);
+LLM_DEFINE_TAG(Mythos_AI);
+LLM_DEFINE_TAG(Mythos_Projectiles);
+LLM_DEFINE_TAG(Mythos_Presentation);
+
+namespace
+{
+	// Totals for one group of characters
+	struct FMythosCharacterMemory
+	{
+		int32 Characters = 0;
+		SIZE_T AbilitySystemBytes = 0;
+		int32 AttributeSets = 0;
+		SIZE_T AttributeSetBytes = 0;
+		int32 GrantedAbilities = 0;
+		int32 AbilityInstances = 0;
+		int32 ActiveEffects = 0;
+
+		void Add(const FMythosCharacterMemory& Other)
+		{
+			Characters += Other.Characters;
+			AbilitySystemBytes += Other.AbilitySystemBytes;
+			AttributeSets += Other.AttributeSets;
+			AttributeSetBytes += Other.AttributeSetBytes;
+			GrantedAbilities += Other.GrantedAbilities;
+			AbilityInstances += Other.AbilityInstances;
+			ActiveEffects += Other.ActiveEffects;
+		}
+
+		void Log(const TCHAR* Label) const
+		{
+			UE_LOG(LogMythosAbility, Log, TEXT("%-24s %5d chars | ASC %8.1f KB | sets %5d (%7.1f KB) | abilities %5d, instances %5d | active effects %6d"),
+				Label, Characters, AbilitySystemBytes / 1024.0, AttributeSets, AttributeSetBytes / 1024.0, GrantedAbilities, AbilityInstances, ActiveEffects);
+		}
+	};
+
+	FMythosCharacterMemory MeasureCharacter(const AMythosCharacter* Character)
+	{
+		FMythosCharacterMemory Memory;
+		Memory.Characters = 1;
+
+		UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+		if (!ASC)
+		{
+			return Memory;
+		}
+
+		Memory.AbilitySystemBytes = ASC->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		for (const UAttributeSet* Set : ASC->GetSpawnedAttributes())
+		{
+			if (Set)
+			{
+				++Memory.AttributeSets;
+				Memory.AttributeSetBytes += Set->GetClass()->GetStructureSize();
+			}
+		}
+
+		for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+		{
+			++Memory.GrantedAbilities;
+			Memory.AbilityInstances += Spec.GetAbilityInstances().Num();
+		}
+		Memory.ActiveEffects = ASC->GetNumActiveGameplayEffects();
+		return Memory;
+	}
+}
+
+static FAutoConsoleCommandWithWorldAndArgs MythosMemoryDumpCommand(
+	TEXT("Mythos.Memory.Dump"),
+	TEXT("Log Mythos memory per system and per character group. 'chars' lists every character, 'timers' also lists the world's timers."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (!World)
+		{
+			return;
+		}
+
+		const bool bPerCharacter = Args.Contains(TEXT("chars"));
+		const bool bTimers = Args.Contains(TEXT("timers"));
+
+		UE_LOG(LogMythosAbility, Log, TEXT("==== Mythos memory (%s) ===="), *World->GetMapName());
+
+		FMythosCharacterMemory Players;
+		FMythosCharacterMemory ActiveEnemies;
+		FMythosCharacterMemory PooledEnemies;
+		for (TActorIterator<AMythosCharacter> It(World); It; ++It)
+		{
+			const FMythosCharacterMemory Memory = MeasureCharacter(*It);
+			const AMythosEnemyBase* Enemy = Cast<AMythosEnemyBase>(*It);
+			(Enemy ? (Enemy->IsInPool() ? PooledEnemies : ActiveEnemies) : Players).Add(Memory);
+
+			if (bPerCharacter)
+			{
+				Memory.Log(*It->GetName());
+			}
+		}
+
+		FMythosCharacterMemory Total;
+		Total.Add(Players);
+		Total.Add(ActiveEnemies);
+		Total.Add(PooledEnemies);
+		Players.Log(TEXT("Players"));
+		ActiveEnemies.Log(TEXT("Enemies (active)"));
+		PooledEnemies.Log(TEXT("Enemies (pooled)"));
+		Total.Log(TEXT("Total"));
+		if (Total.Characters > 0)
+		{
+			UE_LOG(LogMythosAbility, Log, TEXT("Per character: ASC %.1f KB, %.1f active effects"),
+				Total.AbilitySystemBytes / 1024.0 / Total.Characters, static_cast<double>(Total.ActiveEffects) / Total.Characters);
+		}
+
+		int32 Projectiles = 0;
+		SIZE_T ProjectileBytes = 0;
+		for (TActorIterator<AMythosProjectileActor> It(World); It; ++It)
+		{
+			++Projectiles;
+			ProjectileBytes += It->GetResourceSizeBytes(EResourceSizeMode::EstimatedTotal);
+		}
+		UE_LOG(LogMythosAbility, Log, TEXT("Projectiles: %d (%.1f KB)"), Projectiles, ProjectileBytes / 1024.0);
+
+		// Effects created with NewObject at runtime live in the transient package, a growing count is a per-cast leak
+		int32 TransientEffects = 0;
+		for (TObjectIterator<UGameplayEffect> It(RF_ClassDefaultObject | RF_ArchetypeObject); It; ++It)
+		{
+			TransientEffects += It->GetOuter() == GetTransientPackage() ? 1 : 0;
+		}
+		UE_LOG(LogMythosAbility, Log, TEXT("Transient gameplay effects: %d"), TransientEffects);
+
+		if (bTimers)
+		{
+			World->GetTimerManager().ListTimers();
+		}
+		UE_LOG(LogMythosAbility, Log, TEXT("Run with -llm and use \"stat LLMFULL\" for the Mythos/... tracker tags"));
+	}));
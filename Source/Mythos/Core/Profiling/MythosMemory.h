@@ -0,0 +1,22 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+// Low Level Memory tracker tags, shown as Mythos/... in "stat LLMFULL" and -llmcsv (run with -llm)
+
+// ASCs, attribute sets, granted ability instances and their timers
+LLM_DECLARE_TAG_API(Mythos_AbilitySystem, MYTHOS_API);
+
+// effect specs, active effects and transient per-cast effects
+LLM_DECLARE_TAG_API(Mythos_Effects, MYTHOS_API);
+
+// enemy pool, significance, scheduler, batch, token and threat bookkeeping
+LLM_DECLARE_TAG_API(Mythos_AI, MYTHOS_API);
+
+LLM_DECLARE_TAG_API(Mythos_Projectiles, MYTHOS_API);
+
+// pooled VFX / SFX components
+LLM_DECLARE_TAG_API(Mythos_Presentation, MYTHOS_API);
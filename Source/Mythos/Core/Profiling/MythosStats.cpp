@@ -0,0 +1,50 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Profiling/MythosStats.h"
+
+CSV_DEFINE_CATEGORY_MODULE(MYTHOS_API, Mythos, true);
+
+DEFINE_STAT(STAT_MythosAbilityActivate);
+DEFINE_STAT(STAT_MythosAbilityTargets);
+DEFINE_STAT(STAT_MythosEnemyAbilityTargets);
+DEFINE_STAT(STAT_MythosDamageExecution);
+DEFINE_STAT(STAT_MythosHealExecution);
+DEFINE_STAT(STAT_MythosPostGEExecute);
+DEFINE_STAT(STAT_MythosMouseWorldPosition);
+DEFINE_STAT(STAT_MythosProjectileTick);
+DEFINE_STAT(STAT_MythosAbilitiesActivated);
+DEFINE_STAT(STAT_MythosTargetQueries);
+DEFINE_STAT(STAT_MythosGEExecutions);
+DEFINE_STAT(STAT_MythosLiveProjectiles);
+DEFINE_STAT(STAT_MythosProjectileMemory);
+
+DEFINE_STAT(STAT_MythosEnemyActivations);
+DEFINE_STAT(STAT_MythosEnemyActivationsPeak);
+DEFINE_STAT(STAT_MythosAttackTokensHeld);
+DEFINE_STAT(STAT_MythosAttackTokensWaiting);
+DEFINE_STAT(STAT_MythosAIScheduler);
+DEFINE_STAT(STAT_MythosAIUpdates);
+DEFINE_STAT(STAT_MythosAIScheduled);
+DEFINE_STAT(STAT_MythosAIBudgetMs);
+DEFINE_STAT(STAT_MythosAIUsedMs);
+DEFINE_STAT(STAT_MythosAISliceLatencyMs);
+
+FMythosCombatCounters& FMythosCombatCounters::Get()
+{
+	static FMythosCombatCounters Counters;
+	return Counters;
+}
+
+FMythosCombatCounters FMythosCombatCounters::operator-(const FMythosCombatCounters& Other) const
+{
+	FMythosCombatCounters Result;
+	Result.AbilityActivations = AbilityActivations - Other.AbilityActivations;
+	Result.TargetQueries = TargetQueries - Other.TargetQueries;
+	Result.TargetsFound = TargetsFound - Other.TargetsFound;
+	Result.TargetQueryCycles = TargetQueryCycles - Other.TargetQueryCycles;
+	Result.EffectExecutions = EffectExecutions - Other.EffectExecutions;
+	Result.ProjectilesSpawned = ProjectilesSpawned - Other.ProjectilesSpawned;
+	Result.ProjectilesDestroyed = ProjectilesDestroyed - Other.ProjectilesDestroyed;
+	return Result;
+}
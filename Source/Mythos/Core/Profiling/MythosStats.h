@@ -0,0 +1,87 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+// "stat Mythos" in the console
+DECLARE_STATS_GROUP(TEXT("Mythos"), STATGROUP_Mythos, STATCAT_Advanced);
+
+// "csvprofile start" / -csvCaptureFrames, timings land under the Mythos category
+CSV_DECLARE_CATEGORY_MODULE_EXTERN(MYTHOS_API, Mythos);
+
+// Cycle counter and CSV timing for one scope, Name is the part after STAT_Mythos
+#define MYTHOS_SCOPE_STAT(Name) \
+	SCOPE_CYCLE_COUNTER(STAT_Mythos##Name); \
+	CSV_SCOPED_TIMING_STAT(Mythos, Name)
+
+// Combat
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ability Activate"), STAT_MythosAbilityActivate, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ability Targets"), STAT_MythosAbilityTargets, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Enemy Ability Targets"), STAT_MythosEnemyAbilityTargets, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Damage Execution"), STAT_MythosDamageExecution, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Heal Execution"), STAT_MythosHealExecution, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Post GE Execute"), STAT_MythosPostGEExecute, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Mouse World Position"), STAT_MythosMouseWorldPosition, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Projectile Tick"), STAT_MythosProjectileTick, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Abilities Activated"), STAT_MythosAbilitiesActivated, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Target Queries"), STAT_MythosTargetQueries, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("GE Executions"), STAT_MythosGEExecutions, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Live Projectiles"), STAT_MythosLiveProjectiles, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_MEMORY_STAT_EXTERN(TEXT("Projectile Memory"), STAT_MythosProjectileMemory, STATGROUP_Mythos, MYTHOS_API);
+
+// AI
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Enemy Activations This Frame"), STAT_MythosEnemyActivations, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Enemy Activations Peak"), STAT_MythosEnemyActivationsPeak, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Attack Tokens Held"), STAT_MythosAttackTokensHeld, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Attack Token Requests Waiting"), STAT_MythosAttackTokensWaiting, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Scheduler"), STAT_MythosAIScheduler, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI Updates This Frame"), STAT_MythosAIUpdates, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("AI Enemies Scheduled"), STAT_MythosAIScheduled, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("AI Budget (ms)"), STAT_MythosAIBudgetMs, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("AI Time Used (ms)"), STAT_MythosAIUsedMs, STATGROUP_Mythos, MYTHOS_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("AI Max Slice Latency (ms)"), STAT_MythosAISliceLatencyMs, STATGROUP_Mythos, MYTHOS_API);
+
+/**
+ * Running totals of combat work since startup, game thread only.
+ * Readers keep a copy and diff it (combat benchmark, hitch detector); unlike the stats above
+ * these are compiled into every configuration.
+ */
+struct MYTHOS_API FMythosCombatCounters
+{
+	uint64 AbilityActivations = 0;
+	uint64 TargetQueries = 0;
+	uint64 TargetsFound = 0;
+	uint64 TargetQueryCycles = 0;
+	uint64 EffectExecutions = 0;
+	uint64 ProjectilesSpawned = 0;
+	uint64 ProjectilesDestroyed = 0;
+
+	static FMythosCombatCounters& Get();
+
+	FMythosCombatCounters operator-(const FMythosCombatCounters& Other) const;
+};
+
+// Counts one target query and its cost, set TargetsFound before the scope ends
+struct FMythosTargetQueryScope
+{
+	int32 TargetsFound = 0;
+
+	FMythosTargetQueryScope()
+		: StartCycles(FPlatformTime::Cycles64())
+	{
+	}
+
+	~FMythosTargetQueryScope()
+	{
+		FMythosCombatCounters& Counters = FMythosCombatCounters::Get();
+		++Counters.TargetQueries;
+		Counters.TargetsFound += TargetsFound;
+		Counters.TargetQueryCycles += FPlatformTime::Cycles64() - StartCycles;
+	}
+
+private:
+	uint64 StartCycles;
+};
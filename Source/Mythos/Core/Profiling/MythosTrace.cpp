@@ -0,0 +1,191 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Profiling/MythosTrace.h"
+
+#if MYTHOS_TRACE_ENABLED
+
+#include "Abilities/GameplayAbility.h"
+#include "AttributeSet.h"
+#include "GameplayEffect.h"
+#include "GameFramework/Actor.h"
+#include "ProfilingDebugging/MiscTrace.h"
+
+UE_TRACE_CHANNEL_DEFINE(MythosCombatChannel)
+
+// Actors are identified by their UObject unique id. Class and attribute names go out once as a
+// NameId event, the combat events only carry its id.
+
+UE_TRACE_EVENT_BEGIN(MythosCombat, NameId, NoSync|Important)
+	UE_TRACE_EVENT_FIELD(uint32, Id)
+	UE_TRACE_EVENT_FIELD(UE::Trace::WideString, Name)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(MythosCombat, AbilityActivated)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Owner)
+	UE_TRACE_EVENT_FIELD(uint32, Activation)
+	UE_TRACE_EVENT_FIELD(uint32, Ability)
+	UE_TRACE_EVENT_FIELD(uint8, AbilityType)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(MythosCombat, AbilityEnded)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Owner)
+	UE_TRACE_EVENT_FIELD(uint32, Activation)
+	UE_TRACE_EVENT_FIELD(uint32, Ability)
+	UE_TRACE_EVENT_FIELD(bool, Cancelled)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(MythosCombat, TargetQuery)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Owner)
+	UE_TRACE_EVENT_FIELD(uint32, Activation)
+	UE_TRACE_EVENT_FIELD(uint32, Ability)
+	UE_TRACE_EVENT_FIELD(uint16, TargetCount)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(MythosCombat, EffectExecuted)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Target)
+	UE_TRACE_EVENT_FIELD(uint32, Effect)
+	UE_TRACE_EVENT_FIELD(uint32, Attribute)
+	UE_TRACE_EVENT_FIELD(float, Delta)
+	UE_TRACE_EVENT_FIELD(float, NewValue)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(MythosCombat, ProjectileSpawned)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Projectile)
+	UE_TRACE_EVENT_FIELD(uint32, Owner)
+UE_TRACE_EVENT_END()
+
+UE_TRACE_EVENT_BEGIN(MythosCombat, ProjectileHit)
+	UE_TRACE_EVENT_FIELD(uint64, Cycle)
+	UE_TRACE_EVENT_FIELD(uint32, Projectile)
+	UE_TRACE_EVENT_FIELD(uint32, HitActor)
+UE_TRACE_EVENT_END()
+
+static uint32 GetTraceId(const UObject* Object)
+{
+	return Object ? Object->GetUniqueID() : 0;
+}
+
+struct FMythosTraceName
+{
+	uint32 Id = 0;
+
+	// "Ability <Name>", one region name per ability class however often it is cast
+	FString RegionName;
+};
+
+// Bounded by the number of ability / effect classes and attributes, all traced from the game thread.
+// NameId is an important event, so the table is replayed to a trace started after the first use.
+static TMap<FName, FMythosTraceName> TracedNames;
+static uint32 NextActivationId = 0;
+
+static FMythosTraceName& GetTracedName(FName InName)
+{
+	if (FMythosTraceName* Traced = TracedNames.Find(InName))
+	{
+		return *Traced;
+	}
+
+	FMythosTraceName& Traced = TracedNames.Add(InName);
+	Traced.Id = TracedNames.Num();
+
+	const FString NameString = InName.ToString();
+	UE_TRACE_LOG(MythosCombat, NameId, MythosCombatChannel)
+		<< NameId.Id(Traced.Id)
+		<< NameId.Name(*NameString, NameString.Len());
+	return Traced;
+}
+
+static FName GetTracedClassName(const UObject* Object)
+{
+	return Object ? Object->GetClass()->GetFName() : NAME_None;
+}
+
+void MythosTrace::AbilityActivated(const UGameplayAbility* Ability, const AActor* Owner, uint8 AbilityType, uint32& OutActivationId, uint64& OutRegionId)
+{
+	FMythosTraceName& AbilityName = GetTracedName(GetTracedClassName(Ability));
+	OutActivationId = ++NextActivationId;
+	UE_TRACE_LOG(MythosCombat, AbilityActivated, MythosCombatChannel)
+		<< AbilityActivated.Cycle(FPlatformTime::Cycles64())
+		<< AbilityActivated.Owner(GetTraceId(Owner))
+		<< AbilityActivated.Activation(OutActivationId)
+		<< AbilityActivated.Ability(AbilityName.Id)
+		<< AbilityActivated.AbilityType(AbilityType);
+
+	// A non-instanced ability has no activation to keep the region on, it would never be closed
+	OutRegionId = 0;
+	if (Ability && Ability->IsInstantiated())
+	{
+		if (AbilityName.RegionName.IsEmpty())
+		{
+			AbilityName.RegionName = FString::Printf(TEXT("Ability %s"), *GetTracedClassName(Ability).ToString());
+		}
+		OutRegionId = FMiscTrace::OutputBeginRegionWithId(*AbilityName.RegionName);
+	}
+}
+
+void MythosTrace::AbilityEnded(const UGameplayAbility* Ability, const AActor* Owner, uint32 ActivationId, uint64 RegionId, bool bWasCancelled)
+{
+	const uint32 AbilityId = GetTracedName(GetTracedClassName(Ability)).Id;
+	UE_TRACE_LOG(MythosCombat, AbilityEnded, MythosCombatChannel)
+		<< AbilityEnded.Cycle(FPlatformTime::Cycles64())
+		<< AbilityEnded.Owner(GetTraceId(Owner))
+		<< AbilityEnded.Activation(ActivationId)
+		<< AbilityEnded.Ability(AbilityId)
+		<< AbilityEnded.Cancelled(bWasCancelled);
+
+	// Nothing is open if the channel was turned on mid cast
+	if (RegionId != 0)
+	{
+		FMiscTrace::OutputEndRegionWithId(RegionId);
+	}
+}
+
+void MythosTrace::TargetQuery(const UGameplayAbility* Ability, const AActor* Owner, uint32 ActivationId, int32 TargetCount)
+{
+	const uint32 AbilityId = GetTracedName(GetTracedClassName(Ability)).Id;
+	UE_TRACE_LOG(MythosCombat, TargetQuery, MythosCombatChannel)
+		<< TargetQuery.Cycle(FPlatformTime::Cycles64())
+		<< TargetQuery.Owner(GetTraceId(Owner))
+		<< TargetQuery.Activation(ActivationId)
+		<< TargetQuery.Ability(AbilityId)
+		<< TargetQuery.TargetCount(static_cast<uint16>(FMath::Min(TargetCount, static_cast<int32>(MAX_uint16))));
+}
+
+void MythosTrace::EffectExecuted(const UGameplayEffect* Effect, const AActor* Target, const FGameplayAttribute& Attribute, float Delta, float NewValue)
+{
+	// Name ids are looked up first, a new one logs its own event and must not land inside this one
+	const uint32 EffectId = GetTracedName(GetTracedClassName(Effect)).Id;
+	const FProperty* AttributeProperty = Attribute.GetUProperty();
+	const uint32 AttributeId = GetTracedName(AttributeProperty ? AttributeProperty->GetFName() : NAME_None).Id;
+	UE_TRACE_LOG(MythosCombat, EffectExecuted, MythosCombatChannel)
+		<< EffectExecuted.Cycle(FPlatformTime::Cycles64())
+		<< EffectExecuted.Target(GetTraceId(Target))
+		<< EffectExecuted.Effect(EffectId)
+		<< EffectExecuted.Attribute(AttributeId)
+		<< EffectExecuted.Delta(Delta)
+		<< EffectExecuted.NewValue(NewValue);
+}
+
+void MythosTrace::ProjectileSpawned(const AActor* Projectile, const AActor* Owner)
+{
+	UE_TRACE_LOG(MythosCombat, ProjectileSpawned, MythosCombatChannel)
+		<< ProjectileSpawned.Cycle(FPlatformTime::Cycles64())
+		<< ProjectileSpawned.Projectile(GetTraceId(Projectile))
+		<< ProjectileSpawned.Owner(GetTraceId(Owner));
+}
+
+void MythosTrace::ProjectileHit(const AActor* Projectile, const AActor* HitActor)
+{
+	UE_TRACE_LOG(MythosCombat, ProjectileHit, MythosCombatChannel)
+		<< ProjectileHit.Cycle(FPlatformTime::Cycles64())
+		<< ProjectileHit.Projectile(GetTraceId(Projectile))
+		<< ProjectileHit.HitActor(GetTraceId(HitActor));
+}
+
+#endif
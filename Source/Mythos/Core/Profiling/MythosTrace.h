@@ -0,0 +1,53 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Trace/Trace.h"
+
+class AActor;
+class UGameplayAbility;
+class UGameplayEffect;
+struct FGameplayAttribute;
+
+// Combat events for Unreal Insights: -trace=default,MythosCombat or "Trace.Enable MythosCombat" at runtime
+UE_TRACE_CHANNEL_EXTERN(MythosCombatChannel, MYTHOS_API);
+
+// compiled into every non-shipping build, a disabled channel costs one branch per call site
+#define MYTHOS_TRACE_ENABLED (UE_TRACE_ENABLED && !UE_BUILD_SHIPPING)
+
+#if MYTHOS_TRACE_ENABLED
+
+namespace MythosTrace
+{
+	// Hands out the activation id and, on instanced abilities, opens a timing region "Ability <Ability>"
+	// next to the CPU timers. Both are kept on the activation and passed back to AbilityEnded.
+	MYTHOS_API void AbilityActivated(const UGameplayAbility* Ability, const AActor* Owner, uint8 AbilityType, uint32& OutActivationId, uint64& OutRegionId);
+
+	// closes the timing region opened by AbilityActivated
+	MYTHOS_API void AbilityEnded(const UGameplayAbility* Ability, const AActor* Owner, uint32 ActivationId, uint64 RegionId, bool bWasCancelled);
+
+	MYTHOS_API void TargetQuery(const UGameplayAbility* Ability, const AActor* Owner, uint32 ActivationId, int32 TargetCount);
+
+	MYTHOS_API void EffectExecuted(const UGameplayEffect* Effect, const AActor* Target, const FGameplayAttribute& Attribute, float Delta, float NewValue);
+
+	MYTHOS_API void ProjectileSpawned(const AActor* Projectile, const AActor* Owner);
+
+	MYTHOS_API void ProjectileHit(const AActor* Projectile, const AActor* HitActor);
+}
+
+// Arguments are only evaluated while the MythosCombat channel is on
+#define MYTHOS_TRACE(Event, ...) \
+	do \
+	{ \
+		if (UE_TRACE_CHANNELEXPR_IS_ENABLED(MythosCombatChannel)) \
+		{ \
+			MythosTrace::Event(__VA_ARGS__); \
+		} \
+	} while (0)
+
+#else
+
+#define MYTHOS_TRACE(Event, ...) do {} while (0)
+
+#endif
@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosAISchedulerSubsystem.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<float> CVarMythosAIBudgetMs(
+	TEXT("Mythos.AI.BudgetMs"),
+	2.0f,
+	TEXT("Milliseconds per frame the AI scheduler may spend on enemy decisions. At least one enemy is updated per frame."),
+	ECVF_Default);
+
+void UMythosAISchedulerSubsystem::RegisterEnemy(AMythosEnemyBase* Enemy)
+{
+	if (Enemy && !Entries.ContainsByPredicate([Enemy](const FEntry& Entry) { return Entry.Enemy.Get() == Enemy; }))
+	{
+		FEntry& Entry = Entries.AddDefaulted_GetRef();
+		Entry.Enemy = Enemy;
+		Entry.LastUpdateTime = GetWorld()->GetTimeSeconds();
+	}
+}
+
+void UMythosAISchedulerSubsystem::UnregisterEnemy(AMythosEnemyBase* Enemy)
+{
+	const int32 Index = Entries.IndexOfByPredicate([Enemy](const FEntry& Entry) { return Entry.Enemy.Get() == Enemy; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// DueEntries holds indices while Tick runs updates, only clear the entry then, the next Tick removes it
+	if (bRunningUpdates)
+	{
+		Entries[Index].Enemy.Reset();
+	}
+	else
+	{
+		Entries.RemoveAtSwap(Index, EAllowShrinking::No);
+	}
+}
+
+void UMythosAISchedulerSubsystem::Tick(float DeltaTime)
+{
+	MYTHOS_SCOPE_STAT(AIScheduler);
+	LLM_SCOPE_BYTAG(Mythos_AI);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Scoring and ordering count toward the budget too
+	const float BudgetMs = FMath::Max(CVarMythosAIBudgetMs.GetValueOnGameThread(), 0.0f);
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+	const uint64 BudgetCycles = static_cast<uint64>(BudgetMs / 1000.0 / FPlatformTime::GetSecondsPerCycle64());
+
+	float MaxWait = 0.0f;
+	for (int32 Index = Entries.Num() - 1; Index >= 0; --Index)
+	{
+		FEntry& Entry = Entries[Index];
+		const AMythosEnemyBase* Enemy = Entry.Enemy.Get();
+		if (!Enemy)
+		{
+			Entries.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		const float Wait = static_cast<float>(Now - Entry.LastUpdateTime);
+		const int32 Bucket = static_cast<int32>(Enemy->GetSignificance());
+		const float Weight = SignificanceWeights.IsValidIndex(Bucket) ? SignificanceWeights[Bucket] : 1.0f;
+		Entry.Score = Wait < MinUpdateInterval ? -1.0f : Wait * Weight;
+		MaxWait = FMath::Max(MaxWait, Wait);
+	}
+
+	// Longest (weighted) wait first. A heap instead of a full sort, only the enemies that fit
+	// in the budget are ever taken out of it
+	DueEntries.Reset();
+	for (int32 Index = 0; Index < Entries.Num(); ++Index)
+	{
+		if (Entries[Index].Score >= 0.0f)
+		{
+			DueEntries.Add(Index);
+		}
+	}
+	const auto ByScore = [this](int32 A, int32 B) { return Entries[A].Score > Entries[B].Score; };
+	DueEntries.Heapify(ByScore);
+
+	int32 NumUpdated = 0;
+	TGuardValue<bool> RunningGuard(bRunningUpdates, true);
+	while (DueEntries.Num() > 0)
+	{
+		if (NumUpdated > 0 && FPlatformTime::Cycles64() - StartCycles >= BudgetCycles)
+		{
+			break;
+		}
+
+		int32 Index = INDEX_NONE;
+		DueEntries.HeapPop(Index, ByScore, EAllowShrinking::No);
+
+		// An earlier update may have unregistered this enemy, its entry is only cleared until the next Tick
+		AMythosEnemyBase* Enemy = Entries[Index].Enemy.Get();
+		if (!Enemy)
+		{
+			continue;
+		}
+
+		// Set before the update, registering another enemy from it can reallocate Entries
+		const float TimeSinceLastUpdate = static_cast<float>(Now - Entries[Index].LastUpdateTime);
+		Entries[Index].LastUpdateTime = Now;
+		Enemy->RunScheduledAIUpdate(TimeSinceLastUpdate);
+		++NumUpdated;
+	}
+
+	SET_DWORD_STAT(STAT_MythosAIUpdates, NumUpdated);
+	SET_DWORD_STAT(STAT_MythosAIScheduled, Entries.Num());
+	SET_FLOAT_STAT(STAT_MythosAIBudgetMs, BudgetMs);
+	SET_FLOAT_STAT(STAT_MythosAIUsedMs, FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles));
+	SET_FLOAT_STAT(STAT_MythosAISliceLatencyMs, MaxWait * 1000.0f);
+}
+
+bool UMythosAISchedulerSubsystem::IsTickable() const
+{
+	return Entries.Num() > 0;
+}
+
+TStatId UMythosAISchedulerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosAISchedulerSubsystem, STATGROUP_Tickables);
+}
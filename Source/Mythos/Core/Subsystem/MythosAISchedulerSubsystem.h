@@ -0,0 +1,57 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MythosAISchedulerSubsystem.generated.h"
+
+class AMythosEnemyBase;
+
+/**
+ * Runs the AI of enemies that opt in (AMythosEnemyBase::bUseScheduledAI) within a fixed per-frame time budget
+ * (Mythos.AI.BudgetMs), on the server only. Their controller's brain (StateTree) is ticked from here instead of
+ * its own component tick, see AMythosEnemyBase::RunScheduledAIUpdate.
+ * Each frame the enemies that waited the longest, weighted by significance, go first, so engaged and
+ * nearby enemies update more often and the rest are spread over the following frames.
+ * "stat Mythos" shows the budget, the time used and the longest an enemy has waited.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosAISchedulerSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void RegisterEnemy(AMythosEnemyBase* Enemy);
+	void UnregisterEnemy(AMythosEnemyBase* Enemy);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	// an enemy is not updated again sooner than this
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	float MinUpdateInterval = 0.1f;
+
+	// how much faster waiting time counts per significance bucket (Critical, High, Medium, Low)
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	TArray<float> SignificanceWeights = { 8.0f, 4.0f, 2.0f, 1.0f };
+
+private:
+	struct FEntry
+	{
+		TWeakObjectPtr<AMythosEnemyBase> Enemy;
+		double LastUpdateTime = 0.0;
+		float Score = 0.0f;
+	};
+
+	TArray<FEntry> Entries;
+
+	// indices into Entries due for an update, kept as a heap on Score and reused every frame
+	TArray<int32> DueEntries;
+
+	// while set, unregistering clears entries instead of removing them so DueEntries stays valid
+	bool bRunningUpdates = false;
+};
@@ -0,0 +1,183 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosAttackTokenSubsystem.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/AbilitySystem/Abilities/Base/MythosGameplayAbility.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "AbilitySystemComponent.h"
+#include "Engine/World.h"
+
+bool UMythosAttackTokenSubsystem::RequestToken(AMythosEnemyBase* Enemy, AActor* Target, int32 Weight, FGameplayTag AbilityTag)
+{
+	if (!Enemy || !Target)
+	{
+		return false;
+	}
+
+	if (HasToken(Enemy, Target))
+	{
+		return true;
+	}
+
+	// Already waiting, keep the place in the queue
+	const bool bQueued = Requests.ContainsByPredicate([Enemy, Target](const FTokenEntry& Entry)
+	{
+		return Entry.Enemy.Get() == Enemy && Entry.Target.Get() == Target;
+	});
+	if (bQueued)
+	{
+		return false;
+	}
+
+	// Tokens for another target are given back, an enemy only attacks one thing at a time
+	ReleaseToken(Enemy);
+
+	FTokenEntry& Request = Requests.AddDefaulted_GetRef();
+	Request.Enemy = Enemy;
+	Request.Target = Target;
+	Request.TargetKey = Target;
+	Request.AbilityTag = AbilityTag;
+	Request.Weight = FMath::Clamp(Weight, 1, TokensPerTarget);
+	return false;
+}
+
+bool UMythosAttackTokenSubsystem::HasToken(const AMythosEnemyBase* Enemy, const AActor* Target) const
+{
+	return Holders.ContainsByPredicate([Enemy, Target](const FTokenEntry& Entry)
+	{
+		return Entry.Enemy.Get() == Enemy && Entry.Target.Get() == Target;
+	});
+}
+
+void UMythosAttackTokenSubsystem::ReleaseToken(const AMythosEnemyBase* Enemy)
+{
+	for (int32 Index = Holders.Num() - 1; Index >= 0; --Index)
+	{
+		if (Holders[Index].Enemy.Get() == Enemy)
+		{
+			RemoveHolder(Index);
+		}
+	}
+
+	Requests.RemoveAll([Enemy](const FTokenEntry& Entry) { return Entry.Enemy.Get() == Enemy; });
+}
+
+void UMythosAttackTokenSubsystem::ReleaseTokenForAbility(const AMythosEnemyBase* Enemy, const UGameplayAbility* Ability)
+{
+	if (!Ability)
+	{
+		return;
+	}
+
+	for (int32 Index = Holders.Num() - 1; Index >= 0; --Index)
+	{
+		const FTokenEntry& Entry = Holders[Index];
+		if (Entry.Enemy.Get() == Enemy && Ability->GetAssetTags().HasTag(Entry.AbilityTag))
+		{
+			RemoveHolder(Index);
+		}
+	}
+}
+
+void UMythosAttackTokenSubsystem::RemoveHolder(int32 Index)
+{
+	const FTokenEntry& Entry = Holders[Index];
+	if (int32* Used = UsedTokens.Find(Entry.TargetKey))
+	{
+		*Used -= Entry.Weight;
+		if (*Used <= 0)
+		{
+			UsedTokens.Remove(Entry.TargetKey);
+		}
+	}
+	Holders.RemoveAtSwap(Index, EAllowShrinking::No);
+}
+
+int32 UMythosAttackTokenSubsystem::GetAbilityTokenWeight(const UAbilitySystemComponent* ASC, FGameplayTag AbilityTag) const
+{
+	if (!ASC)
+	{
+		return 1;
+	}
+
+	TArray<FGameplayAbilitySpec*> Specs;
+	ASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(FGameplayTagContainer(AbilityTag), Specs);
+	const UMythosGameplayAbility* Ability = Specs.Num() > 0 ? Cast<UMythosGameplayAbility>(Specs[0]->Ability) : nullptr;
+	if (!Ability)
+	{
+		return 1;
+	}
+
+	return FMath::Clamp(FMath::CeilToInt(Ability->CostValue.GetValue() / CostPerToken), 1, TokensPerTarget);
+}
+
+void UMythosAttackTokenSubsystem::Tick(float DeltaTime)
+{
+	CSV_SCOPED_TIMING_STAT(Mythos, AttackTokenTick);
+	LLM_SCOPE_BYTAG(Mythos_AI);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	// Take back tokens from dead enemies and abilities that never ended
+	for (int32 Index = Holders.Num() - 1; Index >= 0; --Index)
+	{
+		const FTokenEntry& Entry = Holders[Index];
+		if (!Entry.Enemy.IsValid() || !Entry.Target.IsValid() || Now - Entry.GrantTime > TokenTimeout)
+		{
+			RemoveHolder(Index);
+		}
+	}
+
+	// Hand out tokens oldest request first, a few per frame. A request that does not fit blocks the
+	// younger ones for the same target so a heavy attack is not starved by a stream of light ones
+	TArray<TObjectKey<AActor>, TInlineAllocator<8>> BlockedTargets;
+	int32 NumGranted = 0;
+	for (int32 Index = 0; Index < Requests.Num() && NumGranted < MaxGrantsPerFrame; )
+	{
+		FTokenEntry& Request = Requests[Index];
+		if (!Request.Enemy.IsValid() || !Request.Target.IsValid())
+		{
+			Requests.RemoveAt(Index, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		if (BlockedTargets.Contains(Request.TargetKey))
+		{
+			++Index;
+			continue;
+		}
+
+		int32& Used = UsedTokens.FindOrAdd(Request.TargetKey);
+		if (Used + Request.Weight > TokensPerTarget)
+		{
+			BlockedTargets.Add(Request.TargetKey);
+			++Index;
+			continue;
+		}
+
+		Used += Request.Weight;
+		Request.GrantTime = Now;
+		Holders.Add(Request);
+		Requests.RemoveAt(Index, 1, EAllowShrinking::No);
+		++NumGranted;
+	}
+
+	PeakActivations = FMath::Max(PeakActivations, FrameActivations);
+	SET_DWORD_STAT(STAT_MythosEnemyActivations, FrameActivations);
+	SET_DWORD_STAT(STAT_MythosEnemyActivationsPeak, PeakActivations);
+	SET_DWORD_STAT(STAT_MythosAttackTokensHeld, Holders.Num());
+	SET_DWORD_STAT(STAT_MythosAttackTokensWaiting, Requests.Num());
+	FrameActivations = 0;
+}
+
+bool UMythosAttackTokenSubsystem::IsTickable() const
+{
+	return Holders.Num() > 0 || Requests.Num() > 0 || FrameActivations > 0;
+}
+
+TStatId UMythosAttackTokenSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosAttackTokenSubsystem, STATGROUP_Tickables);
+}
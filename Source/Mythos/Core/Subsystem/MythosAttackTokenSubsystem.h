@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "MythosAttackTokenSubsystem.generated.h"
+
+class AMythosEnemyBase;
+class UAbilitySystemComponent;
+class UGameplayAbility;
+
+/**
+ * Limits how many enemies attack the same target at once.
+ * Every target has TokensPerTarget tokens; an enemy asks for as many as its ability is worth
+ * (by cost) and only activates once they are granted. Grants for the same target are handed out in
+ * request order (a request that does not fit holds back the later ones for that target, other targets
+ * keep going) and at most MaxGrantsPerFrame per frame, so a crowd engaging together attacks over
+ * several frames. Tokens come back when the ability they were requested for ends, or after TokenTimeout.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosAttackTokenSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// True if the enemy holds tokens for Target, otherwise the request is queued (or kept queued)
+	bool RequestToken(AMythosEnemyBase* Enemy, AActor* Target, int32 Weight, FGameplayTag AbilityTag);
+
+	bool HasToken(const AMythosEnemyBase* Enemy, const AActor* Target) const;
+
+	// Give back the enemy's tokens and drop its queued request
+	void ReleaseToken(const AMythosEnemyBase* Enemy);
+
+	// Give back the tokens the enemy was granted for this ability, other abilities ending keep them
+	void ReleaseTokenForAbility(const AMythosEnemyBase* Enemy, const UGameplayAbility* Ability);
+
+	// Tokens the ability matching AbilityTag costs, from its resource cost
+	int32 GetAbilityTokenWeight(const UAbilitySystemComponent* ASC, FGameplayTag AbilityTag) const;
+
+	// Counted for the activations per frame stat
+	void NotifyEnemyActivation() { ++FrameActivations; }
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|AI")
+	int32 GetPeakActivationsPerFrame() const { return PeakActivations; }
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|AI")
+	void ResetPeakActivations() { PeakActivations = 0; }
+
+	// distance enemies keep from the target while waiting for tokens
+	float GetWaitingDistance() const { return WaitingDistance; }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI", meta = (ClampMin = "1"))
+	int32 TokensPerTarget = 3;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI", meta = (ClampMin = "1"))
+	int32 MaxGrantsPerFrame = 2;
+
+	// ability cost worth one token
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI", meta = (ClampMin = "1.0"))
+	float CostPerToken = 25.0f;
+
+	// tokens held longer than this are taken back, in case an ability never ends
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	float TokenTimeout = 4.0f;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	float WaitingDistance = 400.0f;
+
+private:
+	struct FTokenEntry
+	{
+		TWeakObjectPtr<AMythosEnemyBase> Enemy;
+		TWeakObjectPtr<AActor> Target;
+		TObjectKey<AActor> TargetKey;
+
+		// ability the tokens were requested for
+		FGameplayTag AbilityTag;
+		int32 Weight = 1;
+		double GrantTime = 0.0;
+	};
+
+	void RemoveHolder(int32 Index);
+
+	TArray<FTokenEntry> Holders;
+
+	// waiting requests, oldest first
+	TArray<FTokenEntry> Requests;
+
+	// tokens in use per target
+	TMap<TObjectKey<AActor>, int32> UsedTokens;
+
+	int32 FrameActivations = 0;
+	int32 PeakActivations = 0;
+};
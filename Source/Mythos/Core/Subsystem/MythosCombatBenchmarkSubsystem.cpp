@@ -0,0 +1,525 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosCombatBenchmarkSubsystem.h"
+#include "Core/Subsystem/MythosEnemyPoolSubsystem.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/AbilitySystem/Character/MythosEnemyArchetype.h"
+#include "Core/AbilitySystem/Abilities/Benchmark/MythosBenchmarkAbility.h"
+#include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
+#include "Core/AbilitySystem/Component/MythosAttributeSet.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "CoreGlobals.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY(LogMythosBenchmark);
+
+static FAutoConsoleCommandWithWorldAndArgs MythosBenchmarkCombatCommand(
+	TEXT("Mythos.Benchmark.Combat"),
+	TEXT("Spawn a grid of enemies casting the sample abilities and write a JSON report. Args: [Rows=10] [Columns=10] [Seconds=30]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UMythosCombatBenchmarkSubsystem* Benchmark = World ? World->GetSubsystem<UMythosCombatBenchmarkSubsystem>() : nullptr)
+		{
+			Benchmark->StartBenchmark(
+				Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10,
+				Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10,
+				Args.Num() > 2 ? FCString::Atof(*Args[2]) : 30.0f);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs MythosBenchmarkSoakCommand(
+	TEXT("Mythos.Benchmark.Soak"),
+	TEXT("Run the benchmark combat for hours and periodically log tick time, memory, UObjects and GC pauses. Args: [Rows=10] [Columns=10] [Hours=0, until stopped]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UMythosCombatBenchmarkSubsystem* Benchmark = World ? World->GetSubsystem<UMythosCombatBenchmarkSubsystem>() : nullptr)
+		{
+			Benchmark->StartSoak(
+				Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 10,
+				Args.Num() > 1 ? FCString::Atoi(*Args[1]) : 10,
+				Args.Num() > 2 ? FCString::Atof(*Args[2]) : 0.0f);
+		}
+	}));
+
+// Nearest-rank percentile of an unsorted sample
+static float GetPercentile(TArray<float> Samples, float Percentile)
+{
+	if (Samples.Num() == 0)
+	{
+		return 0.0f;
+	}
+
+	Samples.Sort();
+	const int32 Index = FMath::Clamp(FMath::CeilToInt(Percentile * Samples.Num()) - 1, 0, Samples.Num() - 1);
+	return Samples[Index];
+}
+
+static TSharedRef<FJsonObject> MakePercentiles(const TArray<float>& Samples)
+{
+	TSharedRef<FJsonObject> Object = MakeShared<FJsonObject>();
+	Object->SetNumberField(TEXT("p50"), GetPercentile(Samples, 0.50f));
+	Object->SetNumberField(TEXT("p90"), GetPercentile(Samples, 0.90f));
+	Object->SetNumberField(TEXT("p99"), GetPercentile(Samples, 0.99f));
+	Object->SetNumberField(TEXT("max"), GetPercentile(Samples, 1.0f));
+	return Object;
+}
+
+UMythosCombatBenchmarkSubsystem::UMythosCombatBenchmarkSubsystem()
+{
+	// The sample abilities as C++ that runs on the server, can be replaced in DefaultGame.ini
+	Abilities.Add(UMythosBenchmarkBoltAbility::StaticClass());
+	Abilities.Add(UMythosBenchmarkFirewallAbility::StaticClass());
+	Abilities.Add(UMythosBenchmarkExplosionAbility::StaticClass());
+	Abilities.Add(UMythosBenchmarkHealingAuraAbility::StaticClass());
+}
+
+void UMythosCombatBenchmarkSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	PreGCHandle = FCoreUObjectDelegates::GetPreGarbageCollectDelegate().AddUObject(this, &UMythosCombatBenchmarkSubsystem::HandlePreGarbageCollect);
+	PostGCHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddUObject(this, &UMythosCombatBenchmarkSubsystem::HandlePostGarbageCollect);
+}
+
+void UMythosCombatBenchmarkSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	const bool bBenchmark = FParse::Param(FCommandLine::Get(), TEXT("MythosCombatBenchmark"));
+	const bool bSoakTest = FParse::Param(FCommandLine::Get(), TEXT("MythosCombatSoak"));
+	if (!InWorld.IsGameWorld() || (!bBenchmark && !bSoakTest))
+	{
+		return;
+	}
+
+	int32 Rows = 10;
+	int32 Columns = 10;
+	float Seconds = 30.0f;
+	float Hours = 0.0f;
+	FParse::Value(FCommandLine::Get(), TEXT("BenchmarkRows="), Rows);
+	FParse::Value(FCommandLine::Get(), TEXT("BenchmarkColumns="), Columns);
+	FParse::Value(FCommandLine::Get(), TEXT("BenchmarkSeconds="), Seconds);
+	FParse::Value(FCommandLine::Get(), TEXT("BenchmarkReport="), ReportPath);
+	FParse::Value(FCommandLine::Get(), TEXT("SoakHours="), Hours);
+
+	bExitWhenDone = true;
+	if (bSoakTest)
+	{
+		StartSoak(Rows, Columns, Hours);
+	}
+	else
+	{
+		StartBenchmark(Rows, Columns, Seconds);
+	}
+}
+
+void UMythosCombatBenchmarkSubsystem::Deinitialize()
+{
+	if (bSoak && Phase == EPhase::Recording)
+	{
+		LogSoakInterval();
+	}
+
+	FCoreUObjectDelegates::GetPreGarbageCollectDelegate().Remove(PreGCHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGCHandle);
+
+	Phase = EPhase::Idle;
+	Enemies.Reset();
+
+	Super::Deinitialize();
+}
+
+void UMythosCombatBenchmarkSubsystem::StartBenchmark(int32 Rows, int32 Columns, float InDuration)
+{
+	if (IsRunning() || GetWorld()->GetNetMode() == NM_Client)
+	{
+		UE_LOG(LogMythosBenchmark, Warning, TEXT("Combat benchmark: already running or not on the server"));
+		return;
+	}
+
+	bSoak = false;
+	GridRows = FMath::Max(Rows, 1);
+	GridColumns = FMath::Max(Columns, 1);
+	Duration = FMath::Max(InDuration, 1.0f);
+
+	SpawnGrid(GridRows, GridColumns);
+	if (Enemies.Num() == 0)
+	{
+		UE_LOG(LogMythosBenchmark, Error, TEXT("Combat benchmark: no enemies could be spawned"));
+		return;
+	}
+
+	FrameTimes.Reset();
+	GameThreadTimes.Reset();
+	CastAttempts = 0;
+	CastFailures = 0;
+	EffectApplications = 0;
+
+	Phase = EPhase::Warmup;
+	PhaseTime = 0.0f;
+	UE_LOG(LogMythosBenchmark, Log, TEXT("Combat benchmark: %dx%d enemies, %.0fs warmup, %.0fs recording"), GridRows, GridColumns, WarmupTime, Duration);
+}
+
+void UMythosCombatBenchmarkSubsystem::StartSoak(int32 Rows, int32 Columns, float Hours)
+{
+	// 0 hours is "until the server stops", the benchmark needs some duration
+	StartBenchmark(Rows, Columns, Hours > 0.0f ? Hours * 3600.0f : MAX_flt);
+	if (IsRunning())
+	{
+		bSoak = true;
+		SoakIntervalTime = 0.0f;
+		SoakIntervalFrames = 0;
+		SoakIntervalGameThreadMs = 0.0;
+		SoakIntervalMaxGameThreadMs = 0.0f;
+		SoakIntervalGCPasses = 0;
+		SoakIntervalMaxGCMs = 0.0;
+		SoakIntervalStartCastAttempts = 0;
+		SoakIntervalStartCastFailures = 0;
+		UE_LOG(LogMythosBenchmark, Log, TEXT("Combat soak: logging every %.0fs"), SoakLogInterval);
+	}
+}
+
+void UMythosCombatBenchmarkSubsystem::SpawnGrid(int32 Rows, int32 Columns)
+{
+	UMythosEnemyPoolSubsystem* Pool = GetWorld()->GetSubsystem<UMythosEnemyPoolSubsystem>();
+	TSubclassOf<AMythosEnemyBase> Class = EnemyClass.IsNull() ? AMythosEnemyBase::StaticClass() : EnemyClass.LoadSynchronous();
+	UMythosEnemyArchetype* Archetype = EnemyArchetype.LoadSynchronous();
+	if (!Pool || !Class)
+	{
+		return;
+	}
+
+	Enemies.Reset();
+	CastTimers.Reset();
+	NextAbility.Reset();
+
+	const FVector Origin = FVector(-0.5f * (Columns - 1) * GridSpacing, -0.5f * (Rows - 1) * GridSpacing, 100.0f);
+	for (int32 Row = 0; Row < Rows; ++Row)
+	{
+		for (int32 Column = 0; Column < Columns; ++Column)
+		{
+			const FVector Location = Origin + FVector(Column * GridSpacing, Row * GridSpacing, 0.0f);
+			AMythosEnemyBase* Enemy = Pool->SpawnEnemy(Class, FTransform(Location), Archetype);
+			UAbilitySystemComponent* ASC = Enemy ? Enemy->GetAbilitySystemComponent() : nullptr;
+			if (!ASC)
+			{
+				continue;
+			}
+
+			for (const TSubclassOf<UGameplayAbility>& AbilityClass : Abilities)
+			{
+				if (AbilityClass && !ASC->FindAbilitySpecFromClass(AbilityClass))
+				{
+					ASC->GiveAbility(FGameplayAbilitySpec(AbilityClass, 1, INDEX_NONE, Enemy));
+				}
+			}
+
+			// Costs should never be what stops a cast, and nobody dies mid run
+			ASC->SetNumericAttributeBase(UMythosAttributeSet::GetMaxManaAttribute(), 1.0e6f);
+			ASC->SetNumericAttributeBase(UMythosAttributeSet::GetManaAttribute(), 1.0e6f);
+			ASC->SetNumericAttributeBase(UMythosAttributeSet::GetMaxHealthAttribute(), 1.0e6f);
+			ASC->SetNumericAttributeBase(UMythosAttributeSet::GetHealthAttribute(), 1.0e6f);
+
+			// base amount the damage and heal executions scale
+			ASC->SetNumericAttributeBase(UMythosAttributeSet::GetDamageAttribute(), 10.0f);
+			ASC->OnGameplayEffectAppliedDelegateToSelf.AddUObject(this, &UMythosCombatBenchmarkSubsystem::HandleEffectApplied);
+
+			// Stagger the first casts over one interval so they do not all land on one frame
+			const int32 Index = Enemies.Add(Enemy);
+			CastTimers.Add(CastInterval * Index / FMath::Max(Rows * Columns, 1));
+			NextAbility.Add(Index % FMath::Max(Abilities.Num(), 1));
+		}
+	}
+}
+
+void UMythosCombatBenchmarkSubsystem::CastScheduledAbilities(float DeltaTime)
+{
+	if (Abilities.Num() == 0)
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < Enemies.Num(); ++Index)
+	{
+		CastTimers[Index] -= DeltaTime;
+		if (CastTimers[Index] > 0.0f)
+		{
+			continue;
+		}
+		CastTimers[Index] += CastInterval;
+
+		AMythosEnemyBase* Enemy = Enemies[Index].Get();
+		UAbilitySystemComponent* ASC = Enemy ? Enemy->GetAbilitySystemComponent() : nullptr;
+		if (!ASC)
+		{
+			continue;
+		}
+
+		const TSubclassOf<UGameplayAbility>& AbilityClass = Abilities[NextAbility[Index]];
+		NextAbility[Index] = (NextAbility[Index] + 1) % Abilities.Num();
+
+		if (Phase == EPhase::Recording)
+		{
+			++CastAttempts;
+			CastFailures += ASC->TryActivateAbilityByClass(AbilityClass) ? 0 : 1;
+		}
+		else
+		{
+			ASC->TryActivateAbilityByClass(AbilityClass);
+		}
+	}
+}
+
+void UMythosCombatBenchmarkSubsystem::HandleEffectApplied(UAbilitySystemComponent* Source, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	if (Phase == EPhase::Recording)
+	{
+		++EffectApplications;
+	}
+}
+
+void UMythosCombatBenchmarkSubsystem::Tick(float DeltaTime)
+{
+	PhaseTime += DeltaTime;
+
+	if (Phase == EPhase::Warmup && PhaseTime >= WarmupTime)
+	{
+		Phase = EPhase::Recording;
+		PhaseTime = 0.0f;
+		StartCounters = FMythosCombatCounters::Get();
+		StartUsedMemory = FPlatformMemory::GetStats().UsedPhysical;
+		PeakUsedMemory = StartUsedMemory;
+		StartObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		RecordingStartTime = FPlatformTime::Seconds();
+	}
+	else if (Phase == EPhase::Recording)
+	{
+		const float GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+		if (bSoak)
+		{
+			// Hours of samples would be a leak of our own
+			++SoakIntervalFrames;
+			SoakIntervalGameThreadMs += GameThreadMs;
+			SoakIntervalMaxGameThreadMs = FMath::Max(SoakIntervalMaxGameThreadMs, GameThreadMs);
+			SoakIntervalTime += DeltaTime;
+			if (SoakIntervalTime >= SoakLogInterval)
+			{
+				LogSoakInterval();
+			}
+		}
+		else
+		{
+			FrameTimes.Add(FApp::GetDeltaTime() * 1000.0f);
+			GameThreadTimes.Add(GameThreadMs);
+		}
+		PeakUsedMemory = FMath::Max<uint64>(PeakUsedMemory, FPlatformMemory::GetStats().UsedPhysical);
+
+		if (PhaseTime >= Duration)
+		{
+			FinishBenchmark();
+			return;
+		}
+	}
+
+	CastScheduledAbilities(DeltaTime);
+}
+
+void UMythosCombatBenchmarkSubsystem::FinishBenchmark()
+{
+	RecordedCounters = FMythosCombatCounters::Get() - StartCounters;
+	RecordingWallTime = FMath::Max(FPlatformTime::Seconds() - RecordingStartTime, 0.001);
+	EndUsedMemory = FPlatformMemory::GetStats().UsedPhysical;
+	EndObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	EndAbilityInstances = CountAbilityInstances(EndGrantedAbilities);
+	Phase = EPhase::Idle;
+
+	if (bSoak)
+	{
+		LogSoakInterval();
+		UE_LOG(LogMythosBenchmark, Log, TEXT("Combat soak finished after %.1fh, used memory %+.1fMB, UObjects %+d"),
+			RecordingWallTime / 3600.0, (static_cast<double>(EndUsedMemory) - StartUsedMemory) / (1024.0 * 1024.0), EndObjectCount - StartObjectCount);
+	}
+	else
+	{
+		const FString Path = !ReportPath.IsEmpty() ? ReportPath
+			: FPaths::ProjectSavedDir() / TEXT("Benchmarks") / FString::Printf(TEXT("MythosCombat-%s.json"), *FDateTime::Now().ToString());
+		WriteReport(Path);
+	}
+
+	// Numbers from a run whose casts fail describe less combat than asked for
+	if (CastFailures > 0)
+	{
+		UE_LOG(LogMythosBenchmark, Error, TEXT("Combat %s: %llu of %llu casts failed (%.1f%%), the results do not cover the full load"),
+			bSoak ? TEXT("soak") : TEXT("benchmark"), CastFailures, CastAttempts, 100.0 * CastFailures / FMath::Max<uint64>(CastAttempts, 1));
+	}
+
+	for (const TWeakObjectPtr<AMythosEnemyBase>& Enemy : Enemies)
+	{
+		if (AMythosEnemyBase* EnemyActor = Enemy.Get())
+		{
+			if (UAbilitySystemComponent* ASC = EnemyActor->GetAbilitySystemComponent())
+			{
+				ASC->OnGameplayEffectAppliedDelegateToSelf.RemoveAll(this);
+			}
+
+			// Destroyed rather than pooled, pooled enemies would keep the benchmark abilities
+			EnemyActor->Destroy();
+		}
+	}
+	Enemies.Reset();
+
+	if (bExitWhenDone)
+	{
+		// A failing soak fails the job running it
+		FPlatformMisc::RequestExitWithStatus(false, bSoak && CastFailures > 0 ? 1 : 0);
+	}
+}
+
+void UMythosCombatBenchmarkSubsystem::WriteReport(const FString& Path) const
+{
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("build"), FApp::GetBuildVersion());
+	Report->SetStringField(TEXT("configuration"), LexToString(FApp::GetBuildConfiguration()));
+	Report->SetStringField(TEXT("map"), GetWorld()->GetMapName());
+	Report->SetStringField(TEXT("time"), FDateTime::UtcNow().ToIso8601());
+	Report->SetNumberField(TEXT("enemies"), GridRows * GridColumns);
+	Report->SetNumberField(TEXT("seconds"), RecordingWallTime);
+	Report->SetNumberField(TEXT("frames"), FrameTimes.Num());
+
+	Report->SetObjectField(TEXT("frameMs"), MakePercentiles(FrameTimes));
+	Report->SetObjectField(TEXT("gameThreadMs"), MakePercentiles(GameThreadTimes));
+
+	TSharedRef<FJsonObject> Combat = MakeShared<FJsonObject>();
+	Combat->SetNumberField(TEXT("castAttempts"), CastAttempts);
+	Combat->SetNumberField(TEXT("castFailures"), CastFailures);
+	Combat->SetNumberField(TEXT("activationsPerSecond"), RecordedCounters.AbilityActivations / RecordingWallTime);
+	Combat->SetNumberField(TEXT("effectApplicationsPerSecond"), EffectApplications / RecordingWallTime);
+	Combat->SetNumberField(TEXT("effectExecutionsPerSecond"), RecordedCounters.EffectExecutions / RecordingWallTime);
+	Combat->SetNumberField(TEXT("projectilesPerSecond"), RecordedCounters.ProjectilesSpawned / RecordingWallTime);
+	Report->SetObjectField(TEXT("combat"), Combat);
+
+	const double QueryMs = FPlatformTime::ToMilliseconds64(RecordedCounters.TargetQueryCycles);
+	TSharedRef<FJsonObject> Targeting = MakeShared<FJsonObject>();
+	Targeting->SetNumberField(TEXT("queries"), RecordedCounters.TargetQueries);
+	Targeting->SetNumberField(TEXT("totalMs"), QueryMs);
+	Targeting->SetNumberField(TEXT("averageUs"), RecordedCounters.TargetQueries > 0 ? QueryMs * 1000.0 / RecordedCounters.TargetQueries : 0.0);
+	Targeting->SetNumberField(TEXT("targetsPerQuery"), RecordedCounters.TargetQueries > 0 ? static_cast<double>(RecordedCounters.TargetsFound) / RecordedCounters.TargetQueries : 0.0);
+	Report->SetObjectField(TEXT("targetQueries"), Targeting);
+
+	TSharedRef<FJsonObject> Memory = MakeShared<FJsonObject>();
+	Memory->SetNumberField(TEXT("startMB"), StartUsedMemory / (1024.0 * 1024.0));
+	Memory->SetNumberField(TEXT("endMB"), EndUsedMemory / (1024.0 * 1024.0));
+	Memory->SetNumberField(TEXT("peakMB"), PeakUsedMemory / (1024.0 * 1024.0));
+	Memory->SetNumberField(TEXT("uobjectsStart"), StartObjectCount);
+	Memory->SetNumberField(TEXT("uobjectsEnd"), EndObjectCount);
+	Report->SetObjectField(TEXT("memory"), Memory);
+
+	TSharedRef<FJsonObject> AbilityObjects = MakeShared<FJsonObject>();
+	AbilityObjects->SetNumberField(TEXT("granted"), EndGrantedAbilities);
+	AbilityObjects->SetNumberField(TEXT("instances"), EndAbilityInstances);
+	Report->SetObjectField(TEXT("abilities"), AbilityObjects);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	if (FFileHelper::SaveStringToFile(Json, *Path))
+	{
+		UE_LOG(LogMythosBenchmark, Log, TEXT("Combat benchmark: frame p50 %.2fms p99 %.2fms, game thread p99 %.2fms, report written to %s"),
+			GetPercentile(FrameTimes, 0.5f), GetPercentile(FrameTimes, 0.99f), GetPercentile(GameThreadTimes, 0.99f), *Path);
+	}
+	else
+	{
+		UE_LOG(LogMythosBenchmark, Error, TEXT("Combat benchmark: could not write %s"), *Path);
+	}
+}
+
+void UMythosCombatBenchmarkSubsystem::LogSoakInterval()
+{
+	// Growth is against the start of recording, a steady climb over hours is a leak
+	const uint64 UsedMemory = FPlatformMemory::GetStats().UsedPhysical;
+	const int32 ObjectCount = GUObjectArray.GetObjectArrayNumMinusAvailable();
+	const FMythosCombatCounters Counters = FMythosCombatCounters::Get() - StartCounters;
+	int32 GrantedAbilities = 0;
+	const int32 AbilityInstances = CountAbilityInstances(GrantedAbilities);
+
+	UE_LOG(LogMythosBenchmark, Log, TEXT("Soak %.1fm: tick avg %.2fms max %.2fms | used %.1fMB (%+.1fMB) | UObjects %d (%+d), ability instances %d for %d granted | GC %d passes, max %.1fms | activations %llu, executions %llu"),
+		(FPlatformTime::Seconds() - RecordingStartTime) / 60.0,
+		SoakIntervalFrames > 0 ? SoakIntervalGameThreadMs / SoakIntervalFrames : 0.0, SoakIntervalMaxGameThreadMs,
+		UsedMemory / (1024.0 * 1024.0), (static_cast<double>(UsedMemory) - StartUsedMemory) / (1024.0 * 1024.0),
+		ObjectCount, ObjectCount - StartObjectCount, AbilityInstances, GrantedAbilities,
+		SoakIntervalGCPasses, SoakIntervalMaxGCMs,
+		Counters.AbilityActivations, Counters.EffectExecutions);
+
+	const uint64 IntervalAttempts = CastAttempts - SoakIntervalStartCastAttempts;
+	const uint64 IntervalFailures = CastFailures - SoakIntervalStartCastFailures;
+	if (IntervalFailures > 0)
+	{
+		UE_LOG(LogMythosBenchmark, Error, TEXT("Soak: %llu of %llu casts failed this interval (%.1f%%), %llu failed since the start"),
+			IntervalFailures, IntervalAttempts, 100.0 * IntervalFailures / FMath::Max<uint64>(IntervalAttempts, 1), CastFailures);
+	}
+	SoakIntervalStartCastAttempts = CastAttempts;
+	SoakIntervalStartCastFailures = CastFailures;
+
+	SoakIntervalTime = 0.0f;
+	SoakIntervalFrames = 0;
+	SoakIntervalGameThreadMs = 0.0;
+	SoakIntervalMaxGameThreadMs = 0.0f;
+	SoakIntervalGCPasses = 0;
+	SoakIntervalMaxGCMs = 0.0;
+}
+
+int32 UMythosCombatBenchmarkSubsystem::CountAbilityInstances(int32& OutGrantedAbilities) const
+{
+	int32 Instances = 0;
+	OutGrantedAbilities = 0;
+	for (const TWeakObjectPtr<AMythosEnemyBase>& Enemy : Enemies)
+	{
+		const UAbilitySystemComponent* ASC = Enemy.IsValid() ? Enemy->GetAbilitySystemComponent() : nullptr;
+		if (!ASC)
+		{
+			continue;
+		}
+
+		for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+		{
+			++OutGrantedAbilities;
+			Instances += Spec.GetAbilityInstances().Num();
+		}
+	}
+	return Instances;
+}
+
+void UMythosCombatBenchmarkSubsystem::HandlePreGarbageCollect()
+{
+	GCStartTime = FPlatformTime::Seconds();
+}
+
+void UMythosCombatBenchmarkSubsystem::HandlePostGarbageCollect()
+{
+	if (bSoak && Phase == EPhase::Recording && GCStartTime > 0.0)
+	{
+		++SoakIntervalGCPasses;
+		SoakIntervalMaxGCMs = FMath::Max(SoakIntervalMaxGCMs, (FPlatformTime::Seconds() - GCStartTime) * 1000.0);
+	}
+}
+
+bool UMythosCombatBenchmarkSubsystem::IsTickable() const
+{
+	return IsRunning();
+}
+
+TStatId UMythosCombatBenchmarkSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosCombatBenchmarkSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,166 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "MythosCombatBenchmarkSubsystem.generated.h"
+
+class AMythosEnemyBase;
+class UMythosEnemyArchetype;
+class UGameplayAbility;
+class UAbilitySystemComponent;
+struct FGameplayEffectSpec;
+struct FActiveGameplayEffectHandle;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMythosBenchmark, Log, All);
+
+/**
+ * Headless combat throughput benchmark.
+ *
+ * Spawns a grid of enemies, grants them the benchmark versions of the sample abilities (bolt, firewall,
+ * explosion, healing aura, see UMythosBenchmarkAbility) which target their neighbours, apply the damage and
+ * heal executions and end, and casts them on a fixed schedule, then writes frame time percentiles, activations, GE applications,
+ * target query cost and memory growth to Saved/Benchmarks/MythosCombat-<time>.json for diffing between commits.
+ *
+ * From the console: "Mythos.Benchmark.Combat [Rows] [Columns] [Seconds]".
+ * Headless on Linux, any map:
+ *   Mythos <Map> -nullrhi -unattended -MythosCombatBenchmark [-BenchmarkRows=20 -BenchmarkColumns=20 -BenchmarkSeconds=60 -BenchmarkReport=<Path>]
+ * the process exits once the report is written. Compare gameThreadMs between runs, frameMs includes any frame rate cap.
+ * The Mythos.Benchmark.Combat automation test runs a small grid in PIE and checks the report, including that
+ * live ability instances do not grow with the number of enemies.
+ *
+ * Soak mode keeps the same combat running for hours on a dedicated server and logs server tick time,
+ * memory and UObject growth and GC pauses every SoakLogInterval seconds, to catch slow leaks:
+ *   MythosServer <Map> -MythosCombatSoak [-BenchmarkRows=20 -BenchmarkColumns=20 -SoakHours=4]
+ * or "Mythos.Benchmark.Soak [Rows] [Columns] [Hours]" (0 hours runs until the server stops).
+ * Failed casts are logged as errors every interval they happen in, and a command line soak with any failed
+ * cast exits with code 1, a soak that stops casting is not measuring combat anymore.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosCombatBenchmarkSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UMythosCombatBenchmarkSubsystem();
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Benchmark")
+	void StartBenchmark(int32 Rows = 10, int32 Columns = 10, float Duration = 30.0f);
+
+	// Scripted combat without an end report, logs tick time, memory, UObjects and GC pauses periodically
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Benchmark")
+	void StartSoak(int32 Rows = 10, int32 Columns = 10, float Hours = 0.0f);
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Benchmark")
+	bool IsRunning() const { return Phase != EPhase::Idle; }
+
+	// Where the next report goes, empty for Saved/Benchmarks (same as -BenchmarkReport=)
+	void SetReportPath(const FString& Path) { ReportPath = Path; }
+
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Benchmark")
+	TSoftClassPtr<AMythosEnemyBase> EnemyClass;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Benchmark")
+	TSoftObjectPtr<UMythosEnemyArchetype> EnemyArchetype;
+
+	// abilities every benchmark enemy gets and casts in turn
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Benchmark")
+	TArray<TSubclassOf<UGameplayAbility>> Abilities;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Benchmark")
+	float GridSpacing = 300.0f;
+
+	// seconds between two casts of the same enemy, casts are staggered across the grid
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Benchmark")
+	float CastInterval = 1.0f;
+
+	// seconds after spawning before recording starts
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Benchmark")
+	float WarmupTime = 3.0f;
+
+	// seconds between soak log lines
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Benchmark")
+	float SoakLogInterval = 60.0f;
+
+private:
+	enum class EPhase : uint8
+	{
+		Idle,
+		Warmup,
+		Recording
+	};
+
+	void SpawnGrid(int32 Rows, int32 Columns);
+	void CastScheduledAbilities(float DeltaTime);
+	void FinishBenchmark();
+	void HandleEffectApplied(UAbilitySystemComponent* Source, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void WriteReport(const FString& Path) const;
+	void LogSoakInterval();
+
+	// live ability UObjects on the grid, and how many abilities are granted
+	int32 CountAbilityInstances(int32& OutGrantedAbilities) const;
+	void HandlePreGarbageCollect();
+	void HandlePostGarbageCollect();
+
+	EPhase Phase = EPhase::Idle;
+	float PhaseTime = 0.0f;
+	float Duration = 0.0f;
+	int32 GridRows = 0;
+	int32 GridColumns = 0;
+
+	// quit once the report is written (started from the command line)
+	bool bExitWhenDone = false;
+
+	// soak: no per-frame samples are kept, only the current interval
+	bool bSoak = false;
+	float SoakIntervalTime = 0.0f;
+	int32 SoakIntervalFrames = 0;
+	double SoakIntervalGameThreadMs = 0.0;
+	float SoakIntervalMaxGameThreadMs = 0.0f;
+	int32 SoakIntervalGCPasses = 0;
+	uint64 SoakIntervalStartCastAttempts = 0;
+	uint64 SoakIntervalStartCastFailures = 0;
+	double SoakIntervalMaxGCMs = 0.0;
+	double GCStartTime = 0.0;
+	FDelegateHandle PreGCHandle;
+	FDelegateHandle PostGCHandle;
+	FString ReportPath;
+
+	TArray<TWeakObjectPtr<AMythosEnemyBase>> Enemies;
+
+	// per enemy time until its next cast, and which ability it casts next
+	TArray<float> CastTimers;
+	TArray<int32> NextAbility;
+
+	// per recorded frame, milliseconds
+	TArray<float> FrameTimes;
+	TArray<float> GameThreadTimes;
+
+	FMythosCombatCounters StartCounters;
+	FMythosCombatCounters RecordedCounters;
+	uint64 CastAttempts = 0;
+	uint64 CastFailures = 0;
+	uint64 EffectApplications = 0;
+	uint64 StartUsedMemory = 0;
+	uint64 EndUsedMemory = 0;
+	uint64 PeakUsedMemory = 0;
+	int32 StartObjectCount = 0;
+	int32 EndObjectCount = 0;
+	int32 EndAbilityInstances = 0;
+	int32 EndGrantedAbilities = 0;
+	double RecordingWallTime = 0.0;
+	double RecordingStartTime = 0.0;
+};
@@ -0,0 +1,90 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosDebugDrawSubsystem.h"
+#include "Core/Debug/MythosDebug.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+static TAutoConsoleVariable<int32> CVarMythosDebugSegments(
+	TEXT("Mythos.Debug.Segments"),
+	16,
+	TEXT("Segments per circle of Mythos debug spheres and cones."));
+
+void UMythosDebugDrawSubsystem::QueueSphere(const FVector& Center, float Radius, const FColor& Color, float Duration)
+{
+	const int32 Segments = FMath::Max(CVarMythosDebugSegments.GetValueOnGameThread(), 4);
+	AddCircle(Center, FVector::ForwardVector, FVector::RightVector, Radius, Segments, Color, Duration);
+	AddCircle(Center, FVector::ForwardVector, FVector::UpVector, Radius, Segments, Color, Duration);
+	AddCircle(Center, FVector::RightVector, FVector::UpVector, Radius, Segments, Color, Duration);
+}
+
+void UMythosDebugDrawSubsystem::QueueCone(const FVector& Origin, const FVector& Direction, float Length, float HalfAngleRadians, const FColor& Color, float Duration)
+{
+	const FVector Axis = Direction.GetSafeNormal();
+	if (Axis.IsNearlyZero())
+	{
+		return;
+	}
+
+	FVector AxisX;
+	FVector AxisY;
+	Axis.FindBestAxisVectors(AxisX, AxisY);
+
+	const int32 Segments = FMath::Max(CVarMythosDebugSegments.GetValueOnGameThread(), 4);
+	const FVector BaseCenter = Origin + Axis * Length * FMath::Cos(HalfAngleRadians);
+	const float BaseRadius = Length * FMath::Sin(HalfAngleRadians);
+	AddCircle(BaseCenter, AxisX, AxisY, BaseRadius, Segments, Color, Duration);
+
+	// every other segment gets a spoke
+	for (int32 Index = 0; Index < Segments; Index += 2)
+	{
+		const float Angle = UE_TWO_PI * Index / Segments;
+		const FVector Rim = BaseCenter + (AxisX * FMath::Cos(Angle) + AxisY * FMath::Sin(Angle)) * BaseRadius;
+		PendingLines.Emplace(Origin, Rim, Color, Duration, 0.0f, SDPG_World);
+	}
+}
+
+void UMythosDebugDrawSubsystem::AddCircle(const FVector& Center, const FVector& AxisX, const FVector& AxisY, float Radius, int32 Segments, const FColor& Color, float Duration)
+{
+	FVector Previous = Center + AxisX * Radius;
+	for (int32 Index = 1; Index <= Segments; ++Index)
+	{
+		const float Angle = UE_TWO_PI * Index / Segments;
+		const FVector Next = Center + (AxisX * FMath::Cos(Angle) + AxisY * FMath::Sin(Angle)) * Radius;
+		PendingLines.Emplace(Previous, Next, Color, Duration, 0.0f, SDPG_World);
+		Previous = Next;
+	}
+}
+
+bool UMythosDebugDrawSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+#if MYTHOS_DEBUG_ENABLED
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+#else
+	return false;
+#endif
+}
+
+void UMythosDebugDrawSubsystem::Tick(float DeltaTime)
+{
+	CSV_SCOPED_TIMING_STAT(Mythos, DebugDrawTick);
+
+	// timed lines go to the persistent batcher, same as DrawDebugSphere with a lifetime
+	if (ULineBatchComponent* LineBatcher = GetWorld()->GetLineBatcher(UWorld::ELineBatcherType::WorldPersistent))
+	{
+		LineBatcher->DrawLines(PendingLines);
+	}
+	PendingLines.Reset();
+}
+
+bool UMythosDebugDrawSubsystem::IsTickable() const
+{
+	return PendingLines.Num() > 0;
+}
+
+TStatId UMythosDebugDrawSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosDebugDrawSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,38 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Components/LineBatchComponent.h"
+#include "MythosDebugDrawSubsystem.generated.h"
+
+/**
+ * Collects the frame's Mythos debug shapes and hands them to the line batcher in one submission.
+ * Fed by the MYTHOS_DEBUG_* macros in Core/Debug/MythosDebug.h, not created where those compile out.
+ */
+UCLASS()
+class MYTHOS_API UMythosDebugDrawSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// three great circles, cheaper than a latitude/longitude sphere and enough to read a sweep radius
+	void QueueSphere(const FVector& Center, float Radius, const FColor& Color, float Duration);
+
+	// base circle plus spokes from the origin
+	void QueueCone(const FVector& Origin, const FVector& Direction, float Length, float HalfAngleRadians, const FColor& Color, float Duration);
+
+	// UWorldSubsystem
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	void AddCircle(const FVector& Center, const FVector& AxisX, const FVector& AxisY, float Radius, int32 Segments, const FColor& Color, float Duration);
+
+	TArray<FBatchedLine> PendingLines;
+};
@@ -0,0 +1,251 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosEnemyAbilityBatchSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "Core/Subsystem/MythosAttackTokenSubsystem.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
+#include "Core/AbilitySystem/Tags/MythosTagBits.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+int32 UMythosEnemyAbilityBatchSubsystem::RequestAbility(AMythosEnemyBase* Enemy, FGameplayTag AbilityTag, FGameplayTag TargetFilter, float Range, AActor* Target)
+{
+	if (!Enemy || !AbilityTag.IsValid())
+	{
+		return INDEX_NONE;
+	}
+
+	FRequest& Request = PendingRequests.AddDefaulted_GetRef();
+	Request.Id = NextRequestId++;
+	Request.Enemy = Enemy;
+	Request.AbilityTag = AbilityTag;
+	Request.TargetFilter = TargetFilter;
+	Request.Range = Range;
+	Request.Target = Target;
+	Request.bFixedTarget = Target != nullptr;
+
+	Results.Add(Request.Id);
+	return Request.Id;
+}
+
+EMythosAbilityRequestStatus UMythosEnemyAbilityBatchSubsystem::GetRequestStatus(int32 RequestId, AActor** OutTarget) const
+{
+	const FResult* Result = Results.Find(RequestId);
+	if (!Result)
+	{
+		return EMythosAbilityRequestStatus::None;
+	}
+
+	if (OutTarget)
+	{
+		*OutTarget = Result->Target.Get();
+	}
+	return Result->Status;
+}
+
+void UMythosEnemyAbilityBatchSubsystem::ReleaseRequest(int32 RequestId)
+{
+	FResult Result;
+	if (!Results.RemoveAndCopyValue(RequestId, Result) || Result.Status != EMythosAbilityRequestStatus::Pending)
+	{
+		return;
+	}
+
+	const int32 Index = PendingRequests.IndexOfByPredicate([RequestId](const FRequest& Request) { return Request.Id == RequestId; });
+	if (Index == INDEX_NONE)
+	{
+		return;
+	}
+
+	// A pending request may be queued for an attack token, drop it so it is not granted to nobody
+	UMythosAttackTokenSubsystem* Tokens = GetWorld()->GetSubsystem<UMythosAttackTokenSubsystem>();
+	if (const AMythosEnemyBase* Enemy = PendingRequests[Index].Enemy.Get(); Enemy && Tokens)
+	{
+		Tokens->ReleaseToken(Enemy);
+	}
+	PendingRequests.RemoveAt(Index, 1, EAllowShrinking::No);
+}
+
+void UMythosEnemyAbilityBatchSubsystem::UpdateTargetGrid()
+{
+	if (TargetGridFrame == GFrameCounter)
+	{
+		return;
+	}
+	TargetGridFrame = GFrameCounter;
+
+	Targets.Reset();
+	TargetGrid.Reset();
+	for (TActorIterator<AMythosCharacter> It(GetWorld()); It; ++It)
+	{
+		const AMythosEnemyBase* Enemy = Cast<AMythosEnemyBase>(*It);
+		if (It->IsHidden() || (Enemy && Enemy->IsInPool()))
+		{
+			continue;
+		}
+
+		const int32 Index = Targets.Add(*It);
+		TargetGrid.FindOrAdd(GetCell(It->GetActorLocation())).Add(Index);
+	}
+}
+
+FIntPoint UMythosEnemyAbilityBatchSubsystem::GetCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / GridCellSize), FMath::FloorToInt(Location.Y / GridCellSize));
+}
+
+AMythosCharacter* UMythosEnemyAbilityBatchSubsystem::FindNearestTarget(const AMythosEnemyBase* Enemy, FGameplayTag TargetFilter, float Range, float* OutDistance)
+{
+	if (!Enemy)
+	{
+		return nullptr;
+	}
+
+	UpdateTargetGrid();
+
+	const MythosTagBits::FMask FilterMask = MythosTagBits::GetMask(TargetFilter);
+	const FVector Origin = Enemy->GetActorLocation();
+	const FIntPoint MinCell = GetCell(Origin - FVector(Range));
+	const FIntPoint MaxCell = GetCell(Origin + FVector(Range));
+
+	AMythosCharacter* BestTarget = nullptr;
+	float BestDistanceSquared = FMath::Square(Range);
+	for (int32 X = MinCell.X; X <= MaxCell.X; ++X)
+	{
+		for (int32 Y = MinCell.Y; Y <= MaxCell.Y; ++Y)
+		{
+			const TArray<int32>* Cell = TargetGrid.Find(FIntPoint(X, Y));
+			if (!Cell)
+			{
+				continue;
+			}
+
+			for (const int32 Index : *Cell)
+			{
+				AMythosCharacter* Candidate = Targets[Index].Get();
+				if (!Candidate || Candidate == Enemy)
+				{
+					continue;
+				}
+
+				const float DistanceSquared = FVector::DistSquared(Origin, Candidate->GetActorLocation());
+				if (DistanceSquared <= BestDistanceSquared
+					&& (!TargetFilter.IsValid() || MythosTagBits::ActorMatchesTag(Candidate, TargetFilter, FilterMask)))
+				{
+					BestTarget = Candidate;
+					BestDistanceSquared = DistanceSquared;
+				}
+			}
+		}
+	}
+
+	if (OutDistance && BestTarget)
+	{
+		*OutDistance = FMath::Sqrt(BestDistanceSquared);
+	}
+	return BestTarget;
+}
+
+void UMythosEnemyAbilityBatchSubsystem::Tick(float DeltaTime)
+{
+	CSV_SCOPED_TIMING_STAT(Mythos, EnemyAbilityBatchTick);
+	LLM_SCOPE_BYTAG(Mythos_AI);
+
+	const int32 NumToResolve = MaxRequestsPerFrame > 0 ? FMath::Min(MaxRequestsPerFrame, PendingRequests.Num()) : PendingRequests.Num();
+	UMythosAttackTokenSubsystem* Tokens = GetWorld()->GetSubsystem<UMythosAttackTokenSubsystem>();
+
+	// requests still waiting for an attack token, retried next frame
+	TArray<FRequest> Waiting;
+
+	for (int32 Index = 0; Index < NumToResolve; ++Index)
+	{
+		const FRequest& Request = PendingRequests[Index];
+		FResult* Result = Results.Find(Request.Id);
+		AMythosEnemyBase* Enemy = Request.Enemy.Get();
+		if (!Result || !Enemy)
+		{
+			continue;
+		}
+
+		AActor* Target = nullptr;
+		if (Request.bFixedTarget)
+		{
+			// The caller's choice or nothing, a gone or out of range target is not swapped for the nearest one
+			AActor* FixedTarget = Request.Target.Get();
+			if (FixedTarget && !FixedTarget->IsHidden()
+				&& FVector::DistSquared(Enemy->GetActorLocation(), FixedTarget->GetActorLocation()) <= FMath::Square(Request.Range))
+			{
+				Target = FixedTarget;
+			}
+		}
+		else
+		{
+			Target = FindNearestTarget(Enemy, Request.TargetFilter, Request.Range);
+		}
+
+		if (!Target)
+		{
+			Result->Status = EMythosAbilityRequestStatus::NoTarget;
+			continue;
+		}
+
+		AAIController* AIController = Cast<AAIController>(Enemy->GetController());
+		UMythosAbilitySystemComponent* EnemyASC = Enemy->GetAbilitySystemComponent();
+
+		// No token yet, only reposition around the target
+		if (Tokens && !Tokens->RequestToken(Enemy, Target, Tokens->GetAbilityTokenWeight(EnemyASC, Request.AbilityTag), Request.AbilityTag))
+		{
+			if (AIController && AIController->GetMoveStatus() == EPathFollowingStatus::Idle)
+			{
+				// Close in from afar, back off to the ring when already inside it
+				const float WaitingDistance = Tokens->GetWaitingDistance();
+				const FVector FromTarget = Enemy->GetActorLocation() - Target->GetActorLocation();
+				if (FromTarget.SizeSquared2D() > FMath::Square(WaitingDistance))
+				{
+					AIController->MoveToActor(Target, WaitingDistance);
+				}
+				else
+				{
+					AIController->MoveToLocation(Target->GetActorLocation() + FromTarget.GetSafeNormal2D() * WaitingDistance);
+				}
+			}
+			Waiting.Add(Request);
+			continue;
+		}
+
+		// Enemy abilities attack forward, face the target before activating
+		if (AIController)
+		{
+			AIController->SetFocus(Target);
+		}
+		Enemy->SetActorRotation(FRotator(0.0f, (Target->GetActorLocation() - Enemy->GetActorLocation()).Rotation().Yaw, 0.0f));
+
+		const bool bActivated = EnemyASC && EnemyASC->TryActivateAbilitiesByTag(FGameplayTagContainer(Request.AbilityTag));
+		Result->Status = bActivated ? EMythosAbilityRequestStatus::Activated : EMythosAbilityRequestStatus::Failed;
+		Result->Target = Target;
+
+		if (!bActivated && Tokens)
+		{
+			Tokens->ReleaseToken(Enemy);
+		}
+	}
+
+	// Oldest requests first, whatever is left waits for the next frame
+	PendingRequests.RemoveAt(0, NumToResolve, EAllowShrinking::No);
+	PendingRequests.Append(Waiting);
+}
+
+bool UMythosEnemyAbilityBatchSubsystem::IsTickable() const
+{
+	return PendingRequests.Num() > 0;
+}
+
+TStatId UMythosEnemyAbilityBatchSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosEnemyAbilityBatchSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,105 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "MythosEnemyAbilityBatchSubsystem.generated.h"
+
+class AMythosCharacter;
+class AMythosEnemyBase;
+
+/**
+ * Where an enemy ability request is at
+ */
+UENUM(BlueprintType)
+enum class EMythosAbilityRequestStatus : uint8
+{
+	// unknown or released request
+	None,
+
+	// waiting for the next batch
+	Pending,
+
+	// a target was found and the ability activated
+	Activated,
+
+	// nothing to hit in range
+	NoTarget,
+
+	// target found but the ability did not activate (cooldown, cost, blocked)
+	Failed
+};
+
+/**
+ * Collects "find a target and activate this ability" requests from every enemy during a frame and
+ * resolves them together against one target grid built once per frame, then activates the abilities.
+ * The StateTree task and evaluator in Core/AI go through here instead of sweeping per enemy.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosEnemyAbilityBatchSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Queue a request, returns its id for GetRequestStatus / ReleaseRequest.
+	// With a Target the request is resolved against that actor only (e.g. the top threat) instead of the nearest match.
+	int32 RequestAbility(AMythosEnemyBase* Enemy, FGameplayTag AbilityTag, FGameplayTag TargetFilter, float Range, AActor* Target = nullptr);
+
+	EMythosAbilityRequestStatus GetRequestStatus(int32 RequestId, AActor** OutTarget = nullptr) const;
+
+	// Forget a request, cancels it and its queued attack token if it is still pending
+	void ReleaseRequest(int32 RequestId);
+
+	// Closest character matching TargetFilter within Range of the enemy, uses this frame's grid
+	AMythosCharacter* FindNearestTarget(const AMythosEnemyBase* Enemy, FGameplayTag TargetFilter, float Range, float* OutDistance = nullptr);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	// requests resolved per frame, 0 for all; the rest wait for the next frame so a big group's
+	// decisions are spread out instead of landing on one frame
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	int32 MaxRequestsPerFrame = 32;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	float GridCellSize = 1000.0f;
+
+private:
+	struct FRequest
+	{
+		int32 Id = INDEX_NONE;
+		TWeakObjectPtr<AMythosEnemyBase> Enemy;
+		FGameplayTag AbilityTag;
+		FGameplayTag TargetFilter;
+		float Range = 0.0f;
+
+		// chosen by the caller, the grid is not searched
+		TWeakObjectPtr<AActor> Target;
+		bool bFixedTarget = false;
+	};
+
+	struct FResult
+	{
+		EMythosAbilityRequestStatus Status = EMythosAbilityRequestStatus::Pending;
+		TWeakObjectPtr<AActor> Target;
+	};
+
+	// Rebuild the target grid if it is from an earlier frame
+	void UpdateTargetGrid();
+
+	FIntPoint GetCell(const FVector& Location) const;
+
+	TArray<FRequest> PendingRequests;
+	TMap<int32, FResult> Results;
+	int32 NextRequestId = 0;
+
+	// characters that can be targeted and their grid cells, rebuilt at most once per frame
+	TArray<TWeakObjectPtr<AMythosCharacter>> Targets;
+	TMap<FIntPoint, TArray<int32>> TargetGrid;
+	uint64 TargetGridFrame = MAX_uint64;
+};
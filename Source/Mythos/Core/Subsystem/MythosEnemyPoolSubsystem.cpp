@@ -0,0 +1,91 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosEnemyPoolSubsystem.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/AbilitySystem/Character/MythosEnemyArchetype.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "Engine/World.h"
+
+AMythosEnemyBase* UMythosEnemyPoolSubsystem::SpawnEnemy(TSubclassOf<AMythosEnemyBase> EnemyClass, const FTransform& Transform, UMythosEnemyArchetype* Archetype)
+{
+	if (!EnemyClass)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("SpawnEnemy: Invalid EnemyClass"));
+		return nullptr;
+	}
+
+	// Reuse a pooled enemy if we have one
+	if (FMythosEnemyPoolBucket* Bucket = FreeEnemies.Find(EnemyClass))
+	{
+		while (Bucket->Enemies.Num() > 0)
+		{
+			AMythosEnemyBase* Enemy = Bucket->Enemies.Pop(EAllowShrinking::No);
+			if (IsValid(Enemy))
+			{
+				Enemy->ActivateFromPool(Transform, Archetype);
+				return Enemy;
+			}
+		}
+	}
+
+	return SpawnNewEnemy(EnemyClass, Transform, Archetype);
+}
+
+void UMythosEnemyPoolSubsystem::ReleaseEnemy(AMythosEnemyBase* Enemy)
+{
+	if (!IsValid(Enemy) || Enemy->IsInPool())
+	{
+		return;
+	}
+
+	Enemy->DeactivateForPool();
+	FreeEnemies.FindOrAdd(Enemy->GetClass()).Enemies.Add(Enemy);
+}
+
+void UMythosEnemyPoolSubsystem::Prewarm(TSubclassOf<AMythosEnemyBase> EnemyClass, int32 Count, UMythosEnemyArchetype* Archetype)
+{
+	if (!EnemyClass)
+	{
+		return;
+	}
+
+	for (int32 Index = 0; Index < Count; ++Index)
+	{
+		if (AMythosEnemyBase* Enemy = SpawnNewEnemy(EnemyClass, FTransform::Identity, Archetype))
+		{
+			ReleaseEnemy(Enemy);
+		}
+	}
+}
+
+int32 UMythosEnemyPoolSubsystem::GetNumPooled(TSubclassOf<AMythosEnemyBase> EnemyClass) const
+{
+	const FMythosEnemyPoolBucket* Bucket = FreeEnemies.Find(EnemyClass);
+	return Bucket ? Bucket->Enemies.Num() : 0;
+}
+
+AMythosEnemyBase* UMythosEnemyPoolSubsystem::SpawnNewEnemy(TSubclassOf<AMythosEnemyBase> EnemyClass, const FTransform& Transform, UMythosEnemyArchetype* Archetype) const
+{
+	LLM_SCOPE_BYTAG(Mythos_AI);
+
+	// Deferred so BeginPlay applies the requested archetype, not the class default followed by this one
+	AMythosEnemyBase* Enemy = GetWorld()->SpawnActorDeferred<AMythosEnemyBase>(EnemyClass, Transform, nullptr, nullptr,
+		ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+	if (!Enemy)
+	{
+		return nullptr;
+	}
+
+	if (Archetype)
+	{
+		Enemy->Archetype = Archetype;
+	}
+	Enemy->FinishSpawning(Transform);
+
+	if (!Enemy->GetController())
+	{
+		Enemy->SpawnDefaultController();
+	}
+	return Enemy;
+}
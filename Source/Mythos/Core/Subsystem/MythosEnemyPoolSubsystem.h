@@ -0,0 +1,55 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MythosEnemyPoolSubsystem.generated.h"
+
+class AMythosEnemyBase;
+class UMythosEnemyArchetype;
+
+/**
+ * Free enemies of one class
+ */
+USTRUCT()
+struct FMythosEnemyPoolBucket
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<AMythosEnemyBase>> Enemies;
+};
+
+/**
+ * Recycles dead enemies instead of destroying them.
+ * Reused enemies keep their actor, components, ASC and AI controller; only their
+ * attributes, effects, tags and (when the archetype changes) abilities are reset.
+ */
+UCLASS()
+class MYTHOS_API UMythosEnemyPoolSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Take a pooled enemy of this class, or spawn one if the pool is empty
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Pool")
+	AMythosEnemyBase* SpawnEnemy(TSubclassOf<AMythosEnemyBase> EnemyClass, const FTransform& Transform, UMythosEnemyArchetype* Archetype);
+
+	// Return an enemy to the pool, it is hidden and stops ticking until reused
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Pool")
+	void ReleaseEnemy(AMythosEnemyBase* Enemy);
+
+	// Spawn enemies up front so the first wave is also just activations
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Pool")
+	void Prewarm(TSubclassOf<AMythosEnemyBase> EnemyClass, int32 Count, UMythosEnemyArchetype* Archetype);
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Enemy|Pool")
+	int32 GetNumPooled(TSubclassOf<AMythosEnemyBase> EnemyClass) const;
+
+private:
+	AMythosEnemyBase* SpawnNewEnemy(TSubclassOf<AMythosEnemyBase> EnemyClass, const FTransform& Transform, UMythosEnemyArchetype* Archetype) const;
+
+	UPROPERTY()
+	TMap<TSubclassOf<AMythosEnemyBase>, FMythosEnemyPoolBucket> FreeEnemies;
+};
@@ -0,0 +1,242 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosEnemySignificanceSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "AIController.h"
+#include "BrainComponent.h"
+#include "Engine/World.h"
+
+UMythosEnemySignificanceSubsystem::UMythosEnemySignificanceSubsystem()
+{
+	// Defaults, can be overridden in DefaultGame.ini
+	SetDefaultBuckets(Buckets);
+}
+
+void UMythosEnemySignificanceSubsystem::SetDefaultBuckets(TArray<FMythosSignificanceBucketSettings>& OutBuckets)
+{
+	OutBuckets.Reset();
+	OutBuckets.SetNum(4);
+
+	// Critical - full rate
+	OutBuckets[0].MaxDistance = 0.0f;
+
+	// High
+	OutBuckets[1].MaxDistance = 2000.0f;
+	OutBuckets[1].bEnableUpdateRateOptimizations = true;
+
+	// Medium
+	OutBuckets[2].MaxDistance = 5000.0f;
+	OutBuckets[2].MovementTickInterval = 1.0f / 20.0f;
+	OutBuckets[2].MeshTickInterval = 1.0f / 15.0f;
+	OutBuckets[2].bEnableUpdateRateOptimizations = true;
+	OutBuckets[2].AbilitySystemTickInterval = 1.0f / 15.0f;
+	OutBuckets[2].AITickInterval = 0.2f;
+
+	// Low
+	OutBuckets[3].MaxDistance = TNumericLimits<float>::Max();
+	OutBuckets[3].MovementTickInterval = 0.2f;
+	OutBuckets[3].MeshTickInterval = 0.25f;
+	OutBuckets[3].bEnableUpdateRateOptimizations = true;
+	OutBuckets[3].bOnlyTickPoseWhenRendered = true;
+	OutBuckets[3].AbilitySystemTickInterval = 0.25f;
+	OutBuckets[3].AITickInterval = 0.5f;
+}
+
+void UMythosEnemySignificanceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// An emptied Buckets array in config would leave nothing to index
+	if (Buckets.IsEmpty())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("MythosEnemySignificanceSubsystem: Buckets is empty in config, using the defaults"));
+		SetDefaultBuckets(Buckets);
+	}
+}
+
+void UMythosEnemySignificanceSubsystem::RegisterEnemy(AMythosEnemyBase* Enemy)
+{
+	if (Enemy)
+	{
+		Enemies.AddUnique(Enemy);
+	}
+}
+
+void UMythosEnemySignificanceSubsystem::UnregisterEnemy(AMythosEnemyBase* Enemy)
+{
+	Enemies.RemoveSwap(Enemy);
+}
+
+void UMythosEnemySignificanceSubsystem::PromoteEnemy(AMythosEnemyBase* Enemy)
+{
+	if (!Enemy)
+	{
+		return;
+	}
+
+	Enemy->LastCombatTime = GetWorld()->GetTimeSeconds();
+	if (Enemy->GetSignificance() != EMythosEnemySignificance::Critical)
+	{
+		ApplySignificance(Enemy, EMythosEnemySignificance::Critical);
+	}
+}
+
+const FMythosSignificanceBucketSettings& UMythosEnemySignificanceSubsystem::GetBucketSettings(EMythosEnemySignificance Significance) const
+{
+	// Buckets can still be emptied in the editor after Initialize, full rate is the safe answer
+	if (Buckets.IsEmpty())
+	{
+		static const FMythosSignificanceBucketSettings FullRate;
+		return FullRate;
+	}
+
+	const int32 Index = FMath::Clamp(static_cast<int32>(Significance), 0, Buckets.Num() - 1);
+	return Buckets[Index];
+}
+
+void UMythosEnemySignificanceSubsystem::Tick(float DeltaTime)
+{
+	CSV_SCOPED_TIMING_STAT(Mythos, EnemySignificanceTick);
+	LLM_SCOPE_BYTAG(Mythos_AI);
+
+	TimeSinceEvaluation += DeltaTime;
+	if (TimeSinceEvaluation < EvaluationInterval)
+	{
+		return;
+	}
+	TimeSinceEvaluation = 0.0f;
+
+	UWorld* World = GetWorld();
+
+	// Gather every player's view once per evaluation
+	TArray<FVector> ViewLocations;
+	TArray<FVector> ViewDirections;
+	for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->GetPawn())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+			ViewDirections.Add(ViewRotation.Vector());
+		}
+	}
+
+	const float WorldTime = World->GetTimeSeconds();
+	for (int32 Index = Enemies.Num() - 1; Index >= 0; --Index)
+	{
+		AMythosEnemyBase* Enemy = Enemies[Index].Get();
+		if (!Enemy)
+		{
+			Enemies.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		const EMythosEnemySignificance NewSignificance = EvaluateEnemy(Enemy, ViewLocations, ViewDirections, WorldTime);
+		if (NewSignificance != Enemy->GetSignificance())
+		{
+			ApplySignificance(Enemy, NewSignificance);
+		}
+
+		// Same cadence decides whether an idle enemy may go net dormant
+		Enemy->UpdateNetDormancy(WorldTime);
+	}
+}
+
+EMythosEnemySignificance UMythosEnemySignificanceSubsystem::EvaluateEnemy(const AMythosEnemyBase* Enemy, const TArray<FVector>& ViewLocations, const TArray<FVector>& ViewDirections, float WorldTime) const
+{
+	// Engaged enemies always run at full rate
+	if (WorldTime - Enemy->LastCombatTime <= CombatEngagedDuration)
+	{
+		return EMythosEnemySignificance::Critical;
+	}
+
+	const FVector EnemyLocation = Enemy->GetActorLocation();
+	float MinDistanceSquared = TNumericLimits<float>::Max();
+	bool bInView = false;
+	for (int32 ViewIndex = 0; ViewIndex < ViewLocations.Num(); ++ViewIndex)
+	{
+		const FVector ToEnemy = EnemyLocation - ViewLocations[ViewIndex];
+		const float DistanceSquared = ToEnemy.SizeSquared();
+		MinDistanceSquared = FMath::Min(MinDistanceSquared, DistanceSquared);
+
+		// dot(dir, ToEnemy) >= cos * |ToEnemy|, done without a sqrt
+		const float Dot = FVector::DotProduct(ViewDirections[ViewIndex], ToEnemy);
+		if (Dot > 0.0f && Dot * Dot >= ViewConeCosine * ViewConeCosine * DistanceSquared)
+		{
+			bInView = true;
+		}
+	}
+
+	// Bucket by distance, skipping Critical
+	int32 Bucket = static_cast<int32>(EMythosEnemySignificance::Low);
+	for (int32 Index = static_cast<int32>(EMythosEnemySignificance::High); Index < Buckets.Num(); ++Index)
+	{
+		if (MinDistanceSquared <= FMath::Square(Buckets[Index].MaxDistance))
+		{
+			Bucket = Index;
+			break;
+		}
+	}
+
+	// Out of every player's view, drop one bucket
+	if (!bInView)
+	{
+		Bucket = FMath::Min(Bucket + 1, static_cast<int32>(EMythosEnemySignificance::Low));
+	}
+
+	return static_cast<EMythosEnemySignificance>(Bucket);
+}
+
+void UMythosEnemySignificanceSubsystem::ApplySignificance(AMythosEnemyBase* Enemy, EMythosEnemySignificance Significance) const
+{
+	const FMythosSignificanceBucketSettings& Settings = GetBucketSettings(Significance);
+	Enemy->Significance = Significance;
+
+	if (UCharacterMovementComponent* Movement = Enemy->GetCharacterMovement())
+	{
+		Movement->SetComponentTickInterval(Settings.MovementTickInterval);
+	}
+
+	if (USkeletalMeshComponent* Mesh = Enemy->GetMesh())
+	{
+		Mesh->SetComponentTickInterval(Settings.MeshTickInterval);
+		Mesh->bEnableUpdateRateOptimizations = Settings.bEnableUpdateRateOptimizations;
+		Mesh->VisibilityBasedAnimTickOption = Settings.bOnlyTickPoseWhenRendered
+			? EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered
+			: EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones;
+	}
+
+	if (UMythosAbilitySystemComponent* ASC = Enemy->GetAbilitySystemComponent())
+	{
+		ASC->SetComponentTickInterval(Settings.AbilitySystemTickInterval);
+	}
+
+	if (AAIController* AIController = Cast<AAIController>(Enemy->GetController()))
+	{
+		AIController->SetActorTickInterval(Settings.AITickInterval);
+		if (UBrainComponent* Brain = AIController->GetBrainComponent())
+		{
+			Brain->SetComponentTickInterval(Settings.AITickInterval);
+		}
+	}
+}
+
+bool UMythosEnemySignificanceSubsystem::IsTickable() const
+{
+	return Enemies.Num() > 0;
+}
+
+TStatId UMythosEnemySignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosEnemySignificanceSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,123 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MythosEnemySignificanceSubsystem.generated.h"
+
+class AMythosEnemyBase;
+
+/**
+ * Significance buckets for enemies, most significant first
+ */
+UENUM(BlueprintType)
+enum class EMythosEnemySignificance : uint8
+{
+	// in combat (recently damaged or casting)
+	Critical UMETA(DisplayName = "Critical"),
+
+	// close to a player
+	High UMETA(DisplayName = "High"),
+
+	// mid range
+	Medium UMETA(DisplayName = "Medium"),
+
+	// far away or out of every player's view
+	Low UMETA(DisplayName = "Low")
+};
+
+/**
+ * Tick settings applied to an enemy while it sits in a bucket
+ * tick intervals are in seconds, 0 means every frame
+ */
+USTRUCT(BlueprintType)
+struct FMythosSignificanceBucketSettings
+{
+	GENERATED_BODY()
+
+	// enemies further than this from every player fall into the next bucket
+	UPROPERTY(EditAnywhere, Category = "Mythos|Significance")
+	float MaxDistance = 0.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Mythos|Significance")
+	float MovementTickInterval = 0.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Mythos|Significance")
+	float MeshTickInterval = 0.0f;
+
+	// let the skeletal mesh skip anim updates (URO)
+	UPROPERTY(EditAnywhere, Category = "Mythos|Significance")
+	bool bEnableUpdateRateOptimizations = false;
+
+	// stop ticking the pose when the mesh is not rendered
+	UPROPERTY(EditAnywhere, Category = "Mythos|Significance")
+	bool bOnlyTickPoseWhenRendered = false;
+
+	UPROPERTY(EditAnywhere, Category = "Mythos|Significance")
+	float AbilitySystemTickInterval = 0.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Mythos|Significance")
+	float AITickInterval = 0.0f;
+};
+
+/**
+ * Buckets every registered enemy by distance to players, player view and combat engagement,
+ * and lowers movement, mesh, ASC and AI tick rates for the less significant ones.
+ * Buckets are re-evaluated on a fixed interval; damage and casting promote immediately.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosEnemySignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	UMythosEnemySignificanceSubsystem();
+
+	void RegisterEnemy(AMythosEnemyBase* Enemy);
+	void UnregisterEnemy(AMythosEnemyBase* Enemy);
+
+	// Put the enemy into the Critical bucket right away and keep it there while engaged
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Significance")
+	void PromoteEnemy(AMythosEnemyBase* Enemy);
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Significance")
+	const FMythosSignificanceBucketSettings& GetBucketSettings(EMythosEnemySignificance Significance) const;
+
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	// settings per bucket, indexed by EMythosEnemySignificance
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Significance")
+	TArray<FMythosSignificanceBucketSettings> Buckets;
+
+	// seconds between bucket evaluations
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Significance")
+	float EvaluationInterval = 0.25f;
+
+	// enemies stay Critical for this long after their last damage or cast
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Significance")
+	float CombatEngagedDuration = 5.0f;
+
+	// cosine of the half angle used for the "in view" check
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Significance")
+	float ViewConeCosine = 0.5f;
+
+private:
+	// one entry per EMythosEnemySignificance
+	static void SetDefaultBuckets(TArray<FMythosSignificanceBucketSettings>& OutBuckets);
+
+	EMythosEnemySignificance EvaluateEnemy(const AMythosEnemyBase* Enemy, const TArray<FVector>& ViewLocations, const TArray<FVector>& ViewDirections, float WorldTime) const;
+
+	void ApplySignificance(AMythosEnemyBase* Enemy, EMythosEnemySignificance Significance) const;
+
+	TArray<TWeakObjectPtr<AMythosEnemyBase>> Enemies;
+
+	float TimeSinceEvaluation = 0.0f;
+};
@@ -0,0 +1,165 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosHitchDetectorSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Async/Async.h"
+#include "Misc/App.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "CoreGlobals.h"
+
+DEFINE_LOG_CATEGORY(LogMythosHitch);
+
+static TAutoConsoleVariable<bool> CVarMythosHitchEnable(
+	TEXT("Mythos.Hitch.Enable"),
+	true,
+	TEXT("Record per-frame combat activity and write a report when a frame hitches."));
+
+static TAutoConsoleVariable<float> CVarMythosHitchThresholdMs(
+	TEXT("Mythos.Hitch.ThresholdMs"),
+	100.0f,
+	TEXT("Frame time in milliseconds above which the recorded window is written to Saved/Hitches."));
+
+static FAutoConsoleCommandWithWorldAndArgs MythosHitchDumpCommand(
+	TEXT("Mythos.Hitch.Dump"),
+	TEXT("Write the recorded combat window to Saved/Hitches now."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UMythosHitchDetectorSubsystem* HitchDetector = World ? World->GetSubsystem<UMythosHitchDetectorSubsystem>() : nullptr)
+		{
+			HitchDetector->DumpWindow(TEXT("manual"));
+		}
+	}));
+
+void UMythosHitchDetectorSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	// allocated once, recording never grows it
+	Frames.SetNum(FMath::Max(HistoryFrames, 1));
+}
+
+void UMythosHitchDetectorSubsystem::Tick(float DeltaTime)
+{
+	const double Now = FPlatformTime::Seconds();
+	const FMythosCombatCounters& Counters = FMythosCombatCounters::Get();
+
+	// skipped frames (disabled, world not ticking) would read as one long hitch, start over instead
+	if (GFrameCounter != LastFrameNumber + 1)
+	{
+		LastFrameNumber = GFrameCounter;
+		LastCounters = Counters;
+		LastTickTime = Now;
+		return;
+	}
+
+	const FMythosCombatCounters Delta = Counters - LastCounters;
+	LastCounters = Counters;
+	LastFrameNumber = GFrameCounter;
+
+	FFrame& Frame = Frames[NextFrame];
+	Frame.FrameNumber = GFrameCounter;
+	Frame.Time = Now;
+	Frame.FrameMs = static_cast<float>((Now - LastTickTime) * 1000.0);
+	// previous frame's game thread time, the engine publishes it one frame late
+	Frame.GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	Frame.TargetQueryMs = static_cast<float>(FPlatformTime::ToMilliseconds64(Delta.TargetQueryCycles));
+	Frame.AbilityActivations = static_cast<uint32>(Delta.AbilityActivations);
+	Frame.TargetQueries = static_cast<uint32>(Delta.TargetQueries);
+	Frame.TargetsFound = static_cast<uint32>(Delta.TargetsFound);
+	Frame.EffectExecutions = static_cast<uint32>(Delta.EffectExecutions);
+	Frame.ProjectilesSpawned = static_cast<uint32>(Delta.ProjectilesSpawned);
+	// clamped so a miscount can never wrap into billions
+	Frame.LiveProjectiles = Counters.ProjectilesSpawned > Counters.ProjectilesDestroyed ? static_cast<uint32>(Counters.ProjectilesSpawned - Counters.ProjectilesDestroyed) : 0;
+
+	NextFrame = (NextFrame + 1) % Frames.Num();
+	RecordedFrames = FMath::Min(RecordedFrames + 1, Frames.Num());
+	LastTickTime = Now;
+
+	if (Frame.FrameMs > CVarMythosHitchThresholdMs.GetValueOnGameThread()
+		&& GetWorld()->GetRealTimeSeconds() > IgnoreFirstSeconds
+		&& Now - LastDumpTime > MinSecondsBetweenDumps
+		&& DumpCount < MaxDumpsPerSession)
+	{
+		// Only automatic dumps are rate limited, Mythos.Hitch.Dump always writes
+		LastDumpTime = Now;
+		++DumpCount;
+		DumpWindow(TEXT("hitch"));
+	}
+}
+
+FString UMythosHitchDetectorSubsystem::DumpWindow(const TCHAR* Reason)
+{
+	if (RecordedFrames == 0)
+	{
+		return FString();
+	}
+
+	const int32 Oldest = RecordedFrames < Frames.Num() ? 0 : NextFrame;
+	const FFrame& Latest = Frames[(NextFrame + Frames.Num() - 1) % Frames.Num()];
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("reason"), Reason);
+	Report->SetStringField(TEXT("build"), FApp::GetBuildVersion());
+	Report->SetStringField(TEXT("configuration"), LexToString(FApp::GetBuildConfiguration()));
+	Report->SetStringField(TEXT("map"), GetWorld()->GetMapName());
+	Report->SetStringField(TEXT("time"), FDateTime::UtcNow().ToIso8601());
+	Report->SetNumberField(TEXT("thresholdMs"), CVarMythosHitchThresholdMs.GetValueOnGameThread());
+	Report->SetNumberField(TEXT("hitchFrame"), static_cast<double>(Latest.FrameNumber));
+	Report->SetNumberField(TEXT("hitchMs"), Latest.FrameMs);
+
+	// oldest first, "secondsAgo" is relative to the hitch frame
+	TArray<TSharedPtr<FJsonValue>> FrameValues;
+	FrameValues.Reserve(RecordedFrames);
+	for (int32 Index = 0; Index < RecordedFrames; ++Index)
+	{
+		const FFrame& Frame = Frames[(Oldest + Index) % Frames.Num()];
+		TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+		Entry->SetNumberField(TEXT("frame"), static_cast<double>(Frame.FrameNumber));
+		Entry->SetNumberField(TEXT("secondsAgo"), Latest.Time - Frame.Time);
+		Entry->SetNumberField(TEXT("frameMs"), Frame.FrameMs);
+		Entry->SetNumberField(TEXT("gameThreadMs"), Frame.GameThreadMs);
+		Entry->SetNumberField(TEXT("activations"), Frame.AbilityActivations);
+		Entry->SetNumberField(TEXT("targetQueries"), Frame.TargetQueries);
+		Entry->SetNumberField(TEXT("targetsFound"), Frame.TargetsFound);
+		Entry->SetNumberField(TEXT("targetQueryMs"), Frame.TargetQueryMs);
+		Entry->SetNumberField(TEXT("effectExecutions"), Frame.EffectExecutions);
+		Entry->SetNumberField(TEXT("projectilesSpawned"), Frame.ProjectilesSpawned);
+		Entry->SetNumberField(TEXT("liveProjectiles"), Frame.LiveProjectiles);
+		FrameValues.Add(MakeShared<FJsonValueObject>(Entry));
+	}
+	Report->SetArrayField(TEXT("frames"), FrameValues);
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Report, Writer);
+
+	const FString Path = FPaths::ProjectSavedDir() / TEXT("Hitches") / FString::Printf(TEXT("MythosHitch-%s-%llu.json"), *FDateTime::Now().ToString(), Latest.FrameNumber);
+	UE_LOG(LogMythosHitch, Warning, TEXT("Frame %llu took %.1fms (%u activations, %u target queries, %u effect executions in the frame), writing %d frames to %s"),
+		Latest.FrameNumber, Latest.FrameMs, Latest.AbilityActivations, Latest.TargetQueries, Latest.EffectExecutions, RecordedFrames, *Path);
+
+	// file IO off the game thread, the frame has already hitched
+	Async(EAsyncExecution::ThreadPool, [Json = MoveTemp(Json), Path]()
+	{
+		if (!FFileHelper::SaveStringToFile(Json, *Path))
+		{
+			UE_LOG(LogMythosHitch, Error, TEXT("Could not write %s"), *Path);
+		}
+	});
+	return Path;
+}
+
+bool UMythosHitchDetectorSubsystem::IsTickable() const
+{
+	return CVarMythosHitchEnable.GetValueOnAnyThread() && GetWorld() && GetWorld()->IsGameWorld();
+}
+
+TStatId UMythosHitchDetectorSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosHitchDetectorSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,80 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "MythosHitchDetectorSubsystem.generated.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMythosHitch, Log, All);
+
+/**
+ * Keeps the last HistoryFrames frames of Mythos combat activity in a ring buffer and, when a frame takes
+ * longer than Mythos.Hitch.ThresholdMs, writes the window to Saved/Hitches/MythosHitch-<time>.json.
+ *
+ * Recording is one counter diff and one fixed-size copy per frame, so it stays on in Shipping and on the
+ * dedicated server. "Mythos.Hitch.Dump" writes the current window on demand.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosHitchDetectorSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// writes the current window, returns the file path or an empty string
+	FString DumpWindow(const TCHAR* Reason);
+
+	// UWorldSubsystem
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	// frames kept, about 5 seconds at 60Hz or 10 seconds at a 30Hz server tick
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Hitch")
+	int32 HistoryFrames = 300;
+
+	// level loading and the first GC hitch, not worth a report
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Hitch")
+	float IgnoreFirstSeconds = 10.0f;
+
+	// a hitch storm writes one report, not one per frame; manual dumps are not limited
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Hitch")
+	float MinSecondsBetweenDumps = 30.0f;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Hitch")
+	int32 MaxDumpsPerSession = 20;
+
+private:
+	// Combat work between two ticks of this subsystem, i.e. one frame
+	struct FFrame
+	{
+		uint64 FrameNumber = 0;
+		double Time = 0.0;
+		float FrameMs = 0.0f;
+		float GameThreadMs = 0.0f;
+		float TargetQueryMs = 0.0f;
+		uint32 AbilityActivations = 0;
+		uint32 TargetQueries = 0;
+		uint32 TargetsFound = 0;
+		uint32 EffectExecutions = 0;
+		uint32 ProjectilesSpawned = 0;
+		uint32 LiveProjectiles = 0;
+	};
+
+	TArray<FFrame> Frames;
+
+	// next slot to write, the oldest frame once the buffer has wrapped
+	int32 NextFrame = 0;
+	int32 RecordedFrames = 0;
+
+	FMythosCombatCounters LastCounters;
+	double LastTickTime = 0.0;
+	uint64 LastFrameNumber = 0;
+	double LastDumpTime = -UE_BIG_NUMBER;
+	int32 DumpCount = 0;
+};
@@ -0,0 +1,254 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosNetReportSubsystem.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/AbilitySystem/Abilities/Base/MythosGameplayAbility.h"
+#include "Core/AbilitySystem/Component/MythosAbilityEffects.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/NetDriver.h"
+#include "Engine/NetConnection.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY(LogMythosNet);
+
+int32 UMythosNetReportSubsystem::NumSamplingReports = 0;
+
+static FAutoConsoleCommandWithWorldAndArgs MythosNetEnemyReportCommand(
+	TEXT("Mythos.Net.EnemyReport"),
+	TEXT("Sample outgoing server bandwidth for N seconds (default 10) and log bytes per actor class and per enemy."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		if (UMythosNetReportSubsystem* Report = World ? World->GetSubsystem<UMythosNetReportSubsystem>() : nullptr)
+		{
+			Report->StartEnemyReport(Args.Num() > 0 ? FCString::Atof(*Args[0]) : 10.0f);
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs MythosNetAbilityLatencyProbeCommand(
+	TEXT("Mythos.Net.AbilityLatencyProbe"),
+	TEXT("Activate the local player's ability with the given tag and log how long until its cost and cooldown apply locally."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UMythosNetReportSubsystem* Report = World ? World->GetSubsystem<UMythosNetReportSubsystem>() : nullptr;
+		if (Report && Args.Num() > 0)
+		{
+			Report->StartAbilityLatencyProbe(FGameplayTag::RequestGameplayTag(FName(*Args[0]), false));
+		}
+	}));
+
+void UMythosNetReportSubsystem::Deinitialize()
+{
+	if (bSamplingEnemyReport)
+	{
+		bSamplingEnemyReport = false;
+		--NumSamplingReports;
+	}
+
+	Super::Deinitialize();
+}
+
+void UMythosNetReportSubsystem::StartEnemyReport(float Duration)
+{
+	UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	if (!NetDriver || !NetDriver->IsServer())
+	{
+		UE_LOG(LogMythosNet, Warning, TEXT("EnemyReport: needs to run on a server with a net driver"));
+		return;
+	}
+
+	StartOutBytes = NetDriver->OutTotalBytes;
+	StartOutPackets = NetDriver->OutTotalPackets;
+	StartTime = FPlatformTime::Seconds();
+	ActorClassBits.Reset();
+	if (!bSamplingEnemyReport)
+	{
+		bSamplingEnemyReport = true;
+		++NumSamplingReports;
+	}
+
+	GetWorld()->GetTimerManager().SetTimer(ReportTimerHandle, this, &UMythosNetReportSubsystem::FinishEnemyReport, FMath::Max(Duration, 1.0f), false);
+	UE_LOG(LogMythosNet, Log, TEXT("EnemyReport: sampling for %.1fs"), FMath::Max(Duration, 1.0f));
+}
+
+UMythosNetReportSubsystem* UMythosNetReportSubsystem::GetActiveEnemyReport(const UWorld* World)
+{
+	if (NumSamplingReports == 0 || !World)
+	{
+		return nullptr;
+	}
+	UMythosNetReportSubsystem* Report = World->GetSubsystem<UMythosNetReportSubsystem>();
+	return Report && Report->bSamplingEnemyReport ? Report : nullptr;
+}
+
+void UMythosNetReportSubsystem::RecordActorBunch(const UClass* ActorClass, int64 NumBits)
+{
+	ActorClassBits.FindOrAdd(ActorClass) += NumBits;
+}
+
+void UMythosNetReportSubsystem::FinishEnemyReport()
+{
+	if (bSamplingEnemyReport)
+	{
+		bSamplingEnemyReport = false;
+		--NumSamplingReports;
+	}
+
+	UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	if (!NetDriver)
+	{
+		return;
+	}
+
+	const double Elapsed = FMath::Max(FPlatformTime::Seconds() - StartTime, 0.001);
+	const uint64 OutBytes = NetDriver->OutTotalBytes - StartOutBytes;
+	const uint64 OutPackets = NetDriver->OutTotalPackets - StartOutPackets;
+
+	int32 NumEnemies = 0;
+	int32 NumDormant = 0;
+	int32 NumMinimal = 0;
+	for (TActorIterator<AMythosEnemyBase> It(GetWorld()); It; ++It)
+	{
+		if (It->IsInPool())
+		{
+			continue;
+		}
+		++NumEnemies;
+		NumDormant += It->NetDormancy != DORM_Awake ? 1 : 0;
+		NumMinimal += It->GetDesiredReplicationMode() == EGameplayEffectReplicationMode::Minimal ? 1 : 0;
+	}
+
+	// Actor channel bytes per class, biggest first; the enemy share is what enemy classes sent
+	TArray<TPair<FString, double>> ClassBytes;
+	double ActorBytes = 0.0;
+	double EnemyBytes = 0.0;
+	for (const TPair<TObjectKey<UClass>, int64>& Pair : ActorClassBits)
+	{
+		const UClass* ActorClass = Pair.Key.ResolveObjectPtr();
+		const double Bytes = Pair.Value / 8.0;
+		ActorBytes += Bytes;
+		EnemyBytes += ActorClass && ActorClass->IsChildOf<AMythosEnemyBase>() ? Bytes : 0.0;
+		ClassBytes.Emplace(ActorClass ? ActorClass->GetName() : FString(TEXT("(no actor)")), Bytes);
+	}
+	ClassBytes.Sort([](const TPair<FString, double>& A, const TPair<FString, double>& B) { return A.Value > B.Value; });
+	ActorClassBits.Reset();
+
+	const int32 NumConnections = FMath::Max(NetDriver->ClientConnections.Num(), 1);
+	const double BytesPerSecond = OutBytes / Elapsed;
+	const double BytesPerEnemy = NumEnemies > 0 ? EnemyBytes / Elapsed / NumEnemies : 0.0;
+
+	static const IConsoleVariable* LegacyCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Mythos.Net.LegacyEnemyReplication"));
+	const bool bLegacy = LegacyCVar && LegacyCVar->GetBool();
+
+	UE_LOG(LogMythosNet, Log, TEXT("==== Mythos enemy net report (%s) ===="), bLegacy ? TEXT("legacy: Mixed, no dormancy") : TEXT("Minimal + dormancy"));
+	UE_LOG(LogMythosNet, Log, TEXT("Duration: %.1fs, Connections: %d"), Elapsed, NetDriver->ClientConnections.Num());
+	UE_LOG(LogMythosNet, Log, TEXT("Enemies: %d (dormant %d, minimal replication %d)"), NumEnemies, NumDormant, NumMinimal);
+	UE_LOG(LogMythosNet, Log, TEXT("Out: %.0f bytes/s, %.1f packets/s, actor channels %.0f bytes/s, packet and other channel overhead %.0f bytes/s"),
+		BytesPerSecond, OutPackets / Elapsed, ActorBytes / Elapsed, FMath::Max(OutBytes - ActorBytes, 0.0) / Elapsed);
+	for (int32 Index = 0; Index < FMath::Min(ClassBytes.Num(), 10); ++Index)
+	{
+		UE_LOG(LogMythosNet, Log, TEXT("  %s: %.0f bytes/s"), *ClassBytes[Index].Key, ClassBytes[Index].Value / Elapsed);
+	}
+	if (ClassBytes.Num() == 0)
+	{
+		UE_LOG(LogMythosNet, Warning, TEXT("  No actor channel bytes recorded, is UMythosActorChannel the Actor channel class in DefaultEngine.ini?"));
+	}
+	UE_LOG(LogMythosNet, Log, TEXT("Enemies: %.0f bytes/s, per enemy %.1f bytes/s, %.1f bytes/s per connection"), EnemyBytes / Elapsed, BytesPerEnemy, BytesPerEnemy / NumConnections);
+}
+
+void UMythosNetReportSubsystem::StartAbilityLatencyProbe(FGameplayTag AbilityTag)
+{
+	const APlayerController* PC = GetWorld()->GetFirstPlayerController();
+	UAbilitySystemComponent* LocalASC = PC ? UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(PC->GetPawn()) : nullptr;
+	if (!LocalASC || !AbilityTag.IsValid() || ProbeASC.IsValid())
+	{
+		UE_LOG(LogMythosNet, Warning, TEXT("AbilityLatencyProbe: needs a local player with an ASC, a valid ability tag and no probe running"));
+		return;
+	}
+
+	// Watch the cost attribute of the ability we are about to activate
+	TArray<FGameplayAbilitySpec*> Specs;
+	LocalASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(FGameplayTagContainer(AbilityTag), Specs);
+	const UMythosGameplayAbility* Ability = Specs.Num() > 0 ? Cast<UMythosGameplayAbility>(Specs[0]->Ability) : nullptr;
+	ProbeAttribute = Ability ? Ability->CostAttribute : FGameplayAttribute();
+
+	ProbeASC = LocalASC;
+	ProbeAbilityTag = AbilityTag;
+	ProbeCostLatency = -1.0;
+	ProbeCooldownLatency = -1.0;
+	ProbeEffectDelegateHandle = LocalASC->OnActiveGameplayEffectAddedDelegateToSelf.AddUObject(this, &UMythosNetReportSubsystem::HandleProbeEffectAdded);
+	if (ProbeAttribute.IsValid())
+	{
+		ProbeAttributeDelegateHandle = LocalASC->GetGameplayAttributeValueChangeDelegate(ProbeAttribute).AddUObject(this, &UMythosNetReportSubsystem::HandleProbeAttributeChanged);
+	}
+
+	ProbeStartTime = FPlatformTime::Seconds();
+	if (!LocalASC->TryActivateAbilitiesByTag(FGameplayTagContainer(AbilityTag)))
+	{
+		UE_LOG(LogMythosNet, Warning, TEXT("AbilityLatencyProbe: %s did not activate"), *AbilityTag.ToString());
+		FinishAbilityLatencyProbe();
+		return;
+	}
+
+	// Anything slower than this is reported as missing
+	GetWorld()->GetTimerManager().SetTimer(ProbeTimerHandle, this, &UMythosNetReportSubsystem::FinishAbilityLatencyProbe, 2.0f, false);
+}
+
+void UMythosNetReportSubsystem::HandleProbeEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle)
+{
+	const double Latency = FPlatformTime::Seconds() - ProbeStartTime;
+
+	// A predicted instant cost shows up as an active effect on the client until the server confirms it
+	if (ProbeCooldownLatency < 0.0 && Spec.Def && Spec.Def->IsA<UMythosCooldownEffect>())
+	{
+		ProbeCooldownLatency = Latency;
+	}
+	else if (ProbeCostLatency < 0.0 && Spec.Def && Spec.Def->IsA<UMythosCostEffect>())
+	{
+		ProbeCostLatency = Latency;
+	}
+}
+
+void UMythosNetReportSubsystem::HandleProbeAttributeChanged(const FOnAttributeChangeData& Data)
+{
+	if (ProbeCostLatency < 0.0 && Data.NewValue < Data.OldValue)
+	{
+		ProbeCostLatency = FPlatformTime::Seconds() - ProbeStartTime;
+	}
+}
+
+void UMythosNetReportSubsystem::FinishAbilityLatencyProbe()
+{
+	GetWorld()->GetTimerManager().ClearTimer(ProbeTimerHandle);
+
+	if (UAbilitySystemComponent* LocalASC = ProbeASC.Get())
+	{
+		LocalASC->OnActiveGameplayEffectAddedDelegateToSelf.Remove(ProbeEffectDelegateHandle);
+		if (ProbeAttribute.IsValid())
+		{
+			LocalASC->GetGameplayAttributeValueChangeDelegate(ProbeAttribute).Remove(ProbeAttributeDelegateHandle);
+		}
+	}
+	ProbeASC.Reset();
+
+	static const IConsoleVariable* PredictCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Mythos.Ability.PredictCostAndCooldown"));
+	const bool bPredicted = PredictCVar && PredictCVar->GetBool();
+
+	const UNetDriver* NetDriver = GetWorld()->GetNetDriver();
+	const UNetConnection* ServerConnection = NetDriver ? NetDriver->ServerConnection.Get() : nullptr;
+	const float PingMs = ServerConnection ? ServerConnection->AvgLag * 1000.0f : 0.0f;
+
+	auto FormatLatency = [](double Latency)
+	{
+		return Latency >= 0.0 ? FString::Printf(TEXT("%.1f ms"), Latency * 1000.0) : FString(TEXT("not seen"));
+	};
+
+	UE_LOG(LogMythosNet, Log, TEXT("==== Mythos ability latency probe (%s) ===="), bPredicted ? TEXT("predicted") : TEXT("server only"));
+	UE_LOG(LogMythosNet, Log, TEXT("Ability: %s, ping %.0f ms"), *ProbeAbilityTag.ToString(), PingMs);
+	UE_LOG(LogMythosNet, Log, TEXT("Cost: %s, Cooldown: %s"), *FormatLatency(ProbeCostLatency), *FormatLatency(ProbeCooldownLatency));
+}
@@ -0,0 +1,102 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "AttributeSet.h"
+#include "ActiveGameplayEffectHandle.h"
+#include "MythosNetReportSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+struct FGameplayEffectSpec;
+struct FOnAttributeChangeData;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMythosNet, Log, All);
+
+/**
+ * Network measurements run from the console.
+ *
+ * Samples the server's outgoing bandwidth for a while and reports it per actor class, from the bunches
+ * UMythosActorChannel sends, and per enemy from the enemy classes' share.
+ * Run "Mythos.Net.EnemyReport [Seconds]" once with Mythos.Net.LegacyEnemyReplication 1
+ * (Mixed replication, no dormancy) and once with 0 to compare before and after.
+ *
+ * Measures how long the owning client waits for an ability's cost and cooldown to show up.
+ * On a client of a local listen server run "NetEmulation.PktLag 100", then
+ * "Mythos.Net.AbilityLatencyProbe <AbilityTag>" once with Mythos.Ability.PredictCostAndCooldown 1 and once with 0.
+ * The Mythos.Net.PredictedCostAndCooldown automation test does the same in PIE and fails if prediction stops working.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosNetReportSubsystem : public UWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Deinitialize() override;
+
+	// Start sampling, the report is logged after Duration seconds
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Network")
+	void StartEnemyReport(float Duration = 10.0f);
+
+	// Activate abilities matching AbilityTag on the local player and log when cost and cooldown land locally
+	// The world's report while one is sampling, null otherwise (cheap enough to call per bunch)
+	static UMythosNetReportSubsystem* GetActiveEnemyReport(const UWorld* World);
+
+	// Called by UMythosActorChannel for every bunch it sends while a report is sampling
+	void RecordActorBunch(const UClass* ActorClass, int64 NumBits);
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Network")
+	void StartAbilityLatencyProbe(FGameplayTag AbilityTag);
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Network")
+	bool IsAbilityLatencyProbeRunning() const { return ProbeASC.IsValid(); }
+
+	// seconds from activation until the last probe saw the cost / cooldown land locally, negative if it never did
+	double GetProbeCostLatency() const { return ProbeCostLatency; }
+	double GetProbeCooldownLatency() const { return ProbeCooldownLatency; }
+
+	// Mythos.Net.PredictedCostAndCooldown automation test: a map where the listen server's client gets
+	// a pawn with an ASC, and the tag of a granted ability with a cost and a cooldown longer than 2 seconds
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Network|Test")
+	FSoftObjectPath LatencyTestMap;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Network|Test")
+	FGameplayTag LatencyTestAbilityTag;
+
+	// emulated lag on the client's outgoing packets
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Network|Test")
+	int32 LatencyTestPktLagMs = 100;
+
+private:
+	void FinishEnemyReport();
+
+	void HandleProbeEffectAdded(UAbilitySystemComponent* Target, const FGameplayEffectSpec& Spec, FActiveGameplayEffectHandle Handle);
+	void HandleProbeAttributeChanged(const FOnAttributeChangeData& Data);
+	void FinishAbilityLatencyProbe();
+
+	FTimerHandle ReportTimerHandle;
+	uint64 StartOutBytes = 0;
+	uint64 StartOutPackets = 0;
+	double StartTime = 0.0;
+	bool bSamplingEnemyReport = false;
+
+	// bits sent on actor channels per actor class while sampling, null class for bunches without an actor
+	TMap<TObjectKey<UClass>, int64> ActorClassBits;
+
+	// reports sampling in any world, lets channels skip the subsystem lookup when there are none
+	static int32 NumSamplingReports;
+
+	TWeakObjectPtr<UAbilitySystemComponent> ProbeASC;
+	FGameplayTag ProbeAbilityTag;
+	FGameplayAttribute ProbeAttribute;
+	FDelegateHandle ProbeEffectDelegateHandle;
+	FDelegateHandle ProbeAttributeDelegateHandle;
+	FTimerHandle ProbeTimerHandle;
+	double ProbeStartTime = 0.0;
+
+	// seconds from activation, negative until seen
+	double ProbeCostLatency = -1.0;
+	double ProbeCooldownLatency = -1.0;
+};
@@ -0,0 +1,379 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosPresentationSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "Particles/ParticleSystem.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Sound/SoundBase.h"
+#include "Components/AudioComponent.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/WorldSettings.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "TimerManager.h"
+
+DEFINE_LOG_CATEGORY(LogMythosPresentation);
+
+static FAutoConsoleCommandWithWorldAndArgs MythosPresentationReportCommand(
+	TEXT("Mythos.Presentation.Report"),
+	TEXT("Log pooled VFX/SFX counters, pass 'reset' to clear them."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		UMythosPresentationSubsystem* Presentation = World ? World->GetSubsystem<UMythosPresentationSubsystem>() : nullptr;
+		if (!Presentation)
+		{
+			return;
+		}
+
+		const FMythosPresentationCounters& Counters = Presentation->GetCounters();
+		UE_LOG(LogMythosPresentation, Log, TEXT("Mythos presentation: requested %d, played %d (reused %d, created %d), culled %d by frame budget, %d by area budget"),
+			Counters.Requested, Counters.Played, Counters.Reused, Counters.Created, Counters.CulledFrameBudget, Counters.CulledAreaBudget);
+
+		if (Args.Num() > 0 && Args[0] == TEXT("reset"))
+		{
+			Presentation->ResetCounters();
+		}
+	}));
+
+bool UMythosPresentationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	// Nothing to see or hear on a dedicated server
+#if UE_SERVER
+	return false;
+#else
+	return !IsRunningDedicatedServer() && Super::ShouldCreateSubsystem(Outer);
+#endif
+}
+
+void UMythosPresentationSubsystem::Deinitialize()
+{
+	for (TPair<TWeakObjectPtr<UObject>, FMythosPresentationPool>& Pair : Pools)
+	{
+		for (UActorComponent* Component : Pair.Value.AllComponents)
+		{
+			if (IsValid(Component))
+			{
+				Component->DestroyComponent();
+			}
+		}
+	}
+	Pools.Reset();
+	ActiveCells.Reset();
+	ActivePerArea.Reset();
+
+	Super::Deinitialize();
+}
+
+void UMythosPresentationSubsystem::PlayEffect(UParticleSystem* Effect, const FTransform& Transform, EMythosPresentationPriority Priority)
+{
+	QueueRequest(PendingEffects, Effect, Transform, Priority);
+}
+
+void UMythosPresentationSubsystem::PlaySound(USoundBase* Sound, const FVector& Location, EMythosPresentationPriority Priority)
+{
+	QueueRequest(PendingSounds, Sound, FTransform(Location), Priority);
+}
+
+void UMythosPresentationSubsystem::QueueRequest(TArray<FRequest>& Queue, UObject* Asset, const FTransform& Transform, EMythosPresentationPriority Priority)
+{
+	if (!Asset)
+	{
+		return;
+	}
+
+	++Counters.Requested;
+
+	FRequest& Request = Queue.AddDefaulted_GetRef();
+	Request.Asset = Asset;
+	Request.Transform = Transform;
+	Request.Priority = Priority;
+}
+
+void UMythosPresentationSubsystem::Tick(float DeltaTime)
+{
+	CSV_SCOPED_TIMING_STAT(Mythos, PresentationTick);
+	LLM_SCOPE_BYTAG(Mythos_Presentation);
+
+	// A few times per pool idle time is enough
+	const double Now = GetWorld()->GetTimeSeconds();
+	if (Now - LastTrimTime >= FMath::Max(PoolIdleTime * 0.25f, 1.0f))
+	{
+		LastTrimTime = Now;
+		TrimIdlePools();
+	}
+
+	if (PendingEffects.Num() == 0 && PendingSounds.Num() == 0)
+	{
+		return;
+	}
+
+	TArray<FVector> ViewLocations;
+	for (FConstPlayerControllerIterator It = GetWorld()->GetPlayerControllerIterator(); It; ++It)
+	{
+		const APlayerController* PC = It->Get();
+		if (PC && PC->IsLocalController())
+		{
+			FVector ViewLocation;
+			FRotator ViewRotation;
+			PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
+			ViewLocations.Add(ViewLocation);
+		}
+	}
+
+	FlushRequests(PendingEffects, MaxEffectsPerFrame, false, ViewLocations);
+	FlushRequests(PendingSounds, MaxSoundsPerFrame, true, ViewLocations);
+}
+
+void UMythosPresentationSubsystem::FlushRequests(TArray<FRequest>& Queue, int32 FrameBudget, bool bSounds, const TArray<FVector>& ViewLocations)
+{
+	if (Queue.Num() == 0)
+	{
+		return;
+	}
+
+	// Priority tier first, then closest to a local view
+	for (FRequest& Request : Queue)
+	{
+		float MinDistance = 0.0f;
+		if (ViewLocations.Num() > 0)
+		{
+			MinDistance = TNumericLimits<float>::Max();
+			for (const FVector& ViewLocation : ViewLocations)
+			{
+				MinDistance = FMath::Min(MinDistance, static_cast<float>(FVector::Dist(ViewLocation, Request.Transform.GetLocation())));
+			}
+		}
+		Request.Score = static_cast<float>(Request.Priority) * 1.0e6f - MinDistance;
+	}
+	Queue.Sort([](const FRequest& A, const FRequest& B) { return A.Score > B.Score; });
+
+	int32 NumStarted = 0;
+	for (const FRequest& Request : Queue)
+	{
+		UObject* Asset = Request.Asset.Get();
+		if (!Asset)
+		{
+			continue;
+		}
+
+		if (NumStarted >= FrameBudget)
+		{
+			++Counters.CulledFrameBudget;
+			continue;
+		}
+
+		const FIntPoint Cell = GetAreaCell(Request.Transform.GetLocation());
+		if (Request.Priority != EMythosPresentationPriority::High && ActivePerArea.FindRef(Cell) >= MaxActivePerArea)
+		{
+			++Counters.CulledAreaBudget;
+			continue;
+		}
+
+		if (bSounds)
+		{
+			StartSound(CastChecked<USoundBase>(Asset), Request.Transform);
+		}
+		else
+		{
+			StartParticle(CastChecked<UParticleSystem>(Asset), Request.Transform);
+		}
+		++NumStarted;
+		++Counters.Played;
+	}
+
+	Queue.Reset();
+}
+
+void UMythosPresentationSubsystem::StartParticle(UParticleSystem* Effect, const FTransform& Transform)
+{
+	FMythosPresentationPool& Pool = Pools.FindOrAdd(Effect);
+	Pool.LastUseTime = GetWorld()->GetTimeSeconds();
+
+	UParticleSystemComponent* Component = nullptr;
+	if (Pool.FreeParticles.Num() > 0)
+	{
+		Component = Pool.FreeParticles.Pop(EAllowShrinking::No);
+		++Counters.Reused;
+	}
+	else
+	{
+		Component = NewObject<UParticleSystemComponent>(GetWorld()->GetWorldSettings());
+		Component->bAutoActivate = false;
+		Component->bAutoDestroy = false;
+		Component->SetTemplate(Effect);
+		Component->OnSystemFinished.AddDynamic(this, &UMythosPresentationSubsystem::HandleParticleFinished);
+		Component->RegisterComponentWithWorld(GetWorld());
+		Pool.AllComponents.Add(Component);
+		++Counters.Created;
+	}
+
+	Component->SetWorldTransform(Transform);
+	Component->ActivateSystem(true);
+	if (Effect->IsLooping())
+	{
+		StopLoopingLater(Component);
+	}
+
+	const FIntPoint Cell = GetAreaCell(Transform.GetLocation());
+	ActiveCells.Add(Component, Cell);
+	++ActivePerArea.FindOrAdd(Cell);
+}
+
+void UMythosPresentationSubsystem::StartSound(USoundBase* Sound, const FTransform& Transform)
+{
+	FMythosPresentationPool& Pool = Pools.FindOrAdd(Sound);
+	Pool.LastUseTime = GetWorld()->GetTimeSeconds();
+
+	UAudioComponent* Component = nullptr;
+	if (Pool.FreeSounds.Num() > 0)
+	{
+		Component = Pool.FreeSounds.Pop(EAllowShrinking::No);
+		++Counters.Reused;
+	}
+	else
+	{
+		Component = NewObject<UAudioComponent>(GetWorld()->GetWorldSettings());
+		Component->bAutoActivate = false;
+		Component->bAutoDestroy = false;
+		Component->bAllowSpatialization = true;
+		Component->SetSound(Sound);
+		Component->OnAudioFinishedNative.AddUObject(this, &UMythosPresentationSubsystem::HandleSoundFinished);
+		Component->RegisterComponentWithWorld(GetWorld());
+		Pool.AllComponents.Add(Component);
+		++Counters.Created;
+	}
+
+	Component->SetWorldLocation(Transform.GetLocation());
+	Component->Play();
+	if (Sound->IsLooping())
+	{
+		StopLoopingLater(Component);
+	}
+
+	const FIntPoint Cell = GetAreaCell(Transform.GetLocation());
+	ActiveCells.Add(Component, Cell);
+	++ActivePerArea.FindOrAdd(Cell);
+}
+
+void UMythosPresentationSubsystem::HandleParticleFinished(UParticleSystemComponent* Component)
+{
+	ReleaseComponent(Component, Component ? Component->Template : nullptr);
+}
+
+void UMythosPresentationSubsystem::HandleSoundFinished(UAudioComponent* Component)
+{
+	ReleaseComponent(Component, Component ? Component->Sound : nullptr);
+}
+
+void UMythosPresentationSubsystem::ReleaseComponent(UActorComponent* Component, UObject* Asset)
+{
+	FIntPoint Cell;
+	if (!Component || !ActiveCells.RemoveAndCopyValue(Component, Cell))
+	{
+		return;
+	}
+
+	int32& AreaCount = ActivePerArea.FindChecked(Cell);
+	if (--AreaCount <= 0)
+	{
+		ActivePerArea.Remove(Cell);
+	}
+
+	FMythosPresentationPool* Pool = Pools.Find(Asset);
+	if (!Pool)
+	{
+		Component->DestroyComponent();
+		return;
+	}
+
+	const int32 NumFree = Pool->FreeParticles.Num() + Pool->FreeSounds.Num();
+	if (NumFree >= MaxPooledPerAsset)
+	{
+		Pool->AllComponents.RemoveSingleSwap(Component, EAllowShrinking::No);
+		Component->DestroyComponent();
+	}
+	else if (UParticleSystemComponent* Particle = Cast<UParticleSystemComponent>(Component))
+	{
+		Pool->FreeParticles.Add(Particle);
+	}
+	else if (UAudioComponent* Audio = Cast<UAudioComponent>(Component))
+	{
+		Pool->FreeSounds.Add(Audio);
+	}
+}
+
+void UMythosPresentationSubsystem::StopLoopingLater(UActorComponent* Component)
+{
+	// Ability presentation is fire and forget, nobody else would ever stop it
+	FTimerHandle TimerHandle;
+	GetWorld()->GetTimerManager().SetTimer(TimerHandle, FTimerDelegate::CreateWeakLambda(this, [this, WeakComponent = TWeakObjectPtr<UActorComponent>(Component)]()
+	{
+		UActorComponent* Playing = WeakComponent.Get();
+		if (!Playing || !ActiveCells.Contains(Playing))
+		{
+			return;
+		}
+
+		// Both finish callbacks release the component once it has stopped
+		if (UParticleSystemComponent* Particle = Cast<UParticleSystemComponent>(Playing))
+		{
+			Particle->DeactivateSystem();
+		}
+		else if (UAudioComponent* Audio = Cast<UAudioComponent>(Playing))
+		{
+			Audio->Stop();
+		}
+	}), LoopingLifetime, false);
+}
+
+void UMythosPresentationSubsystem::TrimIdlePools()
+{
+	const double Now = GetWorld()->GetTimeSeconds();
+	for (auto It = Pools.CreateIterator(); It; ++It)
+	{
+		FMythosPresentationPool& Pool = It.Value();
+		const bool bAssetGone = !It.Key().IsValid();
+		const bool bIdle = Pool.AllComponents.Num() == Pool.FreeParticles.Num() + Pool.FreeSounds.Num() && Now - Pool.LastUseTime >= PoolIdleTime;
+		if (!bAssetGone && !bIdle)
+		{
+			continue;
+		}
+
+		for (UActorComponent* Component : Pool.AllComponents)
+		{
+			if (IsValid(Component))
+			{
+				// only a pool whose asset is gone can still have playing components
+				FIntPoint Cell;
+				if (ActiveCells.RemoveAndCopyValue(Component, Cell))
+				{
+					int32& AreaCount = ActivePerArea.FindChecked(Cell);
+					if (--AreaCount <= 0)
+					{
+						ActivePerArea.Remove(Cell);
+					}
+				}
+				Component->DestroyComponent();
+			}
+		}
+		It.RemoveCurrent();
+	}
+}
+
+FIntPoint UMythosPresentationSubsystem::GetAreaCell(const FVector& Location) const
+{
+	return FIntPoint(FMath::FloorToInt(Location.X / AreaCellSize), FMath::FloorToInt(Location.Y / AreaCellSize));
+}
+
+bool UMythosPresentationSubsystem::IsTickable() const
+{
+	// Pools keep it ticking until they are trimmed
+	return PendingEffects.Num() > 0 || PendingSounds.Num() > 0 || Pools.Num() > 0;
+}
+
+TStatId UMythosPresentationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosPresentationSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,190 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MythosPresentationSubsystem.generated.h"
+
+class UParticleSystem;
+class UParticleSystemComponent;
+class USoundBase;
+class UAudioComponent;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMythosPresentation, Log, All);
+
+/**
+ * How much a cast's presentation matters, culling drops the lowest first
+ */
+UENUM(BlueprintType)
+enum class EMythosPresentationPriority : uint8
+{
+	// enemies and other background casts
+	Low UMETA(DisplayName = "Low"),
+
+	// other players
+	Normal UMETA(DisplayName = "Normal"),
+
+	// the local player's own casts, sorted first and not held to the area budget
+	High UMETA(DisplayName = "High")
+};
+
+/**
+ * Free and in-use components of one asset
+ */
+USTRUCT()
+struct FMythosPresentationPool
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	TArray<TObjectPtr<UParticleSystemComponent>> FreeParticles;
+
+	UPROPERTY()
+	TArray<TObjectPtr<UAudioComponent>> FreeSounds;
+
+	// every component created for the asset, keeps the playing ones alive too
+	UPROPERTY()
+	TArray<TObjectPtr<UActorComponent>> AllComponents;
+
+	// world time the asset last played, idle pools are trimmed
+	double LastUseTime = 0.0;
+};
+
+/**
+ * Running totals, reset with ResetCounters
+ */
+USTRUCT(BlueprintType)
+struct FMythosPresentationCounters
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Mythos|Presentation")
+	int32 Requested = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Mythos|Presentation")
+	int32 Played = 0;
+
+	// played on a pooled component instead of a new one
+	UPROPERTY(BlueprintReadOnly, Category = "Mythos|Presentation")
+	int32 Reused = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Mythos|Presentation")
+	int32 Created = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Mythos|Presentation")
+	int32 CulledFrameBudget = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Mythos|Presentation")
+	int32 CulledAreaBudget = 0;
+};
+
+/**
+ * Plays ability particles and sounds on pooled components.
+ * Requests made during a frame are collected and played together at the end of it: the best ones by
+ * priority and distance to the local view up to the per-frame budget, and at most MaxActivePerArea
+ * playing in one grid cell. The rest are dropped. Not created on dedicated servers.
+ * Looping assets never finish on their own, they are stopped after LoopingLifetime so their component comes back.
+ * Pools hold their asset weakly and are destroyed once idle for PoolIdleTime.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosPresentationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Presentation")
+	void PlayEffect(UParticleSystem* Effect, const FTransform& Transform, EMythosPresentationPriority Priority);
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Presentation")
+	void PlaySound(USoundBase* Sound, const FVector& Location, EMythosPresentationPriority Priority);
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Presentation")
+	const FMythosPresentationCounters& GetCounters() const { return Counters; }
+
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Presentation")
+	void ResetCounters() { Counters = FMythosPresentationCounters(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	// new effects / sounds started per frame
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Presentation")
+	int32 MaxEffectsPerFrame = 16;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Presentation")
+	int32 MaxSoundsPerFrame = 12;
+
+	// effects and sounds playing at once inside one area cell
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Presentation")
+	int32 MaxActivePerArea = 24;
+
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Presentation")
+	float AreaCellSize = 1500.0f;
+
+	// free components kept per asset, extra ones are destroyed when they finish
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Presentation")
+	int32 MaxPooledPerAsset = 16;
+
+	// seconds a looping effect or sound plays before it is stopped and returned to its pool
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Presentation", meta = (ClampMin = "0.1"))
+	float LoopingLifetime = 5.0f;
+
+	// seconds without a request before an asset's pool and its components are destroyed
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|Presentation", meta = (ClampMin = "0.0"))
+	float PoolIdleTime = 30.0f;
+
+private:
+	struct FRequest
+	{
+		TWeakObjectPtr<UObject> Asset;
+		FTransform Transform;
+		EMythosPresentationPriority Priority = EMythosPresentationPriority::Low;
+		float Score = 0.0f;
+	};
+
+	void QueueRequest(TArray<FRequest>& Queue, UObject* Asset, const FTransform& Transform, EMythosPresentationPriority Priority);
+
+	// Play the best requests within budget and cull the rest
+	void FlushRequests(TArray<FRequest>& Queue, int32 FrameBudget, bool bSounds, const TArray<FVector>& ViewLocations);
+
+	void StartParticle(UParticleSystem* Effect, const FTransform& Transform);
+	void StartSound(USoundBase* Sound, const FTransform& Transform);
+
+	// Stop a looping component after LoopingLifetime, its finished callback then releases it
+	void StopLoopingLater(UActorComponent* Component);
+
+	// Destroy pools with nothing playing that were not used for PoolIdleTime, or whose asset is gone
+	void TrimIdlePools();
+
+	UFUNCTION()
+	void HandleParticleFinished(UParticleSystemComponent* Component);
+
+	void HandleSoundFinished(UAudioComponent* Component);
+
+	// Give the component's area slot back and put it in its pool
+	void ReleaseComponent(UActorComponent* Component, UObject* Asset);
+
+	FIntPoint GetAreaCell(const FVector& Location) const;
+
+	TArray<FRequest> PendingEffects;
+	TArray<FRequest> PendingSounds;
+
+	// weak keys, a pool must not keep its asset loaded
+	UPROPERTY()
+	TMap<TWeakObjectPtr<UObject>, FMythosPresentationPool> Pools;
+
+	double LastTrimTime = 0.0;
+
+	// area cell of each playing component
+	TMap<TObjectKey<UActorComponent>, FIntPoint> ActiveCells;
+	TMap<FIntPoint, int32> ActivePerArea;
+
+	FMythosPresentationCounters Counters;
+};
@@ -0,0 +1,111 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosRotationSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "MythosCharacter.h"
+
+DEFINE_LOG_CATEGORY(LogMythosRotation);
+
+int32 UMythosRotationSubsystem::StartRotation(AMythosCharacter* Character, const FQuat& TargetRotation, float Duration)
+{
+	if (!Character)
+	{
+		return INDEX_NONE;
+	}
+
+	// Reuse the character's slot if it is already rotating
+	int32 Slot = Character->SmoothRotationSlot;
+	if (!Characters.IsValidIndex(Slot) || Characters[Slot].Get() != Character)
+	{
+		Slot = Characters.Add(Character);
+		StartRotations.AddUninitialized();
+		TargetRotations.AddUninitialized();
+		Durations.AddUninitialized();
+		Elapsed.AddUninitialized();
+	}
+
+	StartRotations[Slot] = Character->GetActorQuat();
+	TargetRotations[Slot] = TargetRotation;
+	Durations[Slot] = Duration;
+	Elapsed[Slot] = 0.0f;
+	Character->SmoothRotationSlot = Slot;
+
+	UE_LOG(LogMythosRotation, Verbose, TEXT("Starting smooth rotation for %s: Target=%s, Duration=%.2f"),
+		*GetNameSafe(Character), *TargetRotation.Rotator().ToString(), Duration);
+
+	return Slot;
+}
+
+void UMythosRotationSubsystem::StopRotation(int32 Slot)
+{
+	if (Characters.IsValidIndex(Slot))
+	{
+		RemoveSlot(Slot);
+	}
+}
+
+void UMythosRotationSubsystem::RemoveSlot(int32 Slot)
+{
+	if (AMythosCharacter* Character = Characters[Slot].Get())
+	{
+		Character->SmoothRotationSlot = INDEX_NONE;
+	}
+
+	Characters.RemoveAtSwap(Slot, EAllowShrinking::No);
+	StartRotations.RemoveAtSwap(Slot, EAllowShrinking::No);
+	TargetRotations.RemoveAtSwap(Slot, EAllowShrinking::No);
+	Durations.RemoveAtSwap(Slot, EAllowShrinking::No);
+	Elapsed.RemoveAtSwap(Slot, EAllowShrinking::No);
+
+	// The last entry was moved into this slot, patch its index
+	if (Characters.IsValidIndex(Slot))
+	{
+		if (AMythosCharacter* Moved = Characters[Slot].Get())
+		{
+			Moved->SmoothRotationSlot = Slot;
+		}
+	}
+}
+
+void UMythosRotationSubsystem::Tick(float DeltaTime)
+{
+	CSV_SCOPED_TIMING_STAT(Mythos, RotationTick);
+
+	// Walk backwards so completed slots can be swap-removed in place
+	for (int32 Slot = Characters.Num() - 1; Slot >= 0; --Slot)
+	{
+		AMythosCharacter* Character = Characters[Slot].Get();
+		if (!Character)
+		{
+			RemoveSlot(Slot);
+			continue;
+		}
+
+		Elapsed[Slot] += DeltaTime;
+		const float Alpha = FMath::Clamp(Elapsed[Slot] / Durations[Slot], 0.0f, 1.0f);
+
+		if (Alpha >= 1.0f)
+		{
+			// Set final rotation exactly
+			Character->SetActorRotation(TargetRotations[Slot]);
+			RemoveSlot(Slot);
+			continue;
+		}
+
+		// Ease in/out, then slerp along the shortest arc
+		const float SmoothAlpha = FMath::InterpEaseInOut(0.0f, 1.0f, Alpha, 2.0f);
+		Character->SetActorRotation(FQuat::Slerp(StartRotations[Slot], TargetRotations[Slot], SmoothAlpha));
+	}
+}
+
+bool UMythosRotationSubsystem::IsTickable() const
+{
+	// Idle when nobody is rotating
+	return Characters.Num() > 0;
+}
+
+TStatId UMythosRotationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosRotationSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,48 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MythosRotationSubsystem.generated.h"
+
+class AMythosCharacter;
+
+DECLARE_LOG_CATEGORY_EXTERN(LogMythosRotation, Log, Log);
+
+/**
+ * Drives every active SmoothRotateToDirection request in the world from one batched tick.
+ * Characters register a rotation and get a slot index back; the subsystem only ticks while
+ * at least one rotation is running.
+ */
+UCLASS()
+class MYTHOS_API UMythosRotationSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Start (or restart) a rotation for the character, returns the slot it was written to
+	int32 StartRotation(AMythosCharacter* Character, const FQuat& TargetRotation, float Duration);
+
+	// Stop the rotation in the given slot, the character's slot is reset to INDEX_NONE
+	void StopRotation(int32 Slot);
+
+	// Number of characters currently rotating
+	int32 GetNumActiveRotations() const { return Characters.Num(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	// Swap-remove a slot and patch the slot index of the character that moved into it
+	void RemoveSlot(int32 Slot);
+
+	// Rotation state is kept as parallel arrays so the update loop stays on contiguous memory
+	TArray<TWeakObjectPtr<AMythosCharacter>> Characters;
+	TArray<FQuat> StartRotations;
+	TArray<FQuat> TargetRotations;
+	TArray<float> Durations;
+	TArray<float> Elapsed;
+};
@@ -0,0 +1,131 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosThreatSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/Profiling/MythosMemory.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Engine/World.h"
+
+void UMythosThreatSubsystem::QueueDamageThreat(AActor* Target, AActor* Source, float Amount)
+{
+	QueueEvent(Target, Source, Amount, false);
+}
+
+void UMythosThreatSubsystem::QueueHealThreat(AActor* Target, AActor* Healer, float Amount)
+{
+	QueueEvent(Target, Healer, Amount, true);
+}
+
+void UMythosThreatSubsystem::QueueEvent(AActor* Target, AActor* Source, float Amount, bool bHeal)
+{
+	if (!Target || !Source || Amount <= 0.0f || !Target->HasAuthority())
+	{
+		return;
+	}
+
+	UWorld* World = Target->GetWorld();
+	UMythosThreatSubsystem* Threat = World ? World->GetSubsystem<UMythosThreatSubsystem>() : nullptr;
+	if (!Threat)
+	{
+		return;
+	}
+
+	FThreatEvent& Event = Threat->PendingEvents.AddDefaulted_GetRef();
+	Event.Target = Target;
+	Event.Source = Source;
+	Event.Amount = Amount;
+	Event.bHeal = bHeal;
+}
+
+void UMythosThreatSubsystem::UnregisterEnemy(AMythosEnemyBase* Enemy)
+{
+	EngagedEnemies.RemoveSwap(Enemy);
+}
+
+void UMythosThreatSubsystem::Tick(float DeltaTime)
+{
+	CSV_SCOPED_TIMING_STAT(Mythos, ThreatTick);
+	LLM_SCOPE_BYTAG(Mythos_AI);
+
+	const double Now = GetWorld()->GetTimeSeconds();
+
+	for (const FThreatEvent& Event : PendingEvents)
+	{
+		AActor* Source = Event.Source.Get();
+		if (!Source)
+		{
+			continue;
+		}
+
+		if (!Event.bHeal)
+		{
+			// Only enemies keep a table, damage between players is ignored
+			AMythosEnemyBase* Enemy = Cast<AMythosEnemyBase>(Event.Target.Get());
+			if (!Enemy || Enemy == Source || Cast<AMythosEnemyBase>(Source))
+			{
+				continue;
+			}
+
+			const bool bWasEmpty = Enemy->ThreatTable.IsEmpty();
+			Enemy->ThreatTable.AddThreat(Source, Event.Amount * DamageThreatScale, Now, DecayHalfLife);
+			if (bWasEmpty && !Enemy->ThreatTable.IsEmpty())
+			{
+				EngagedEnemies.AddUnique(Enemy);
+				Enemy->NotifyAggro();
+			}
+			continue;
+		}
+
+		// Healing someone enemies are fighting makes the healer a target of those enemies,
+		// the heal threat is split between them
+		const AActor* Healed = Event.Target.Get();
+		TArray<AMythosEnemyBase*, TInlineAllocator<16>> Fighting;
+		for (const TWeakObjectPtr<AMythosEnemyBase>& EnemyPtr : EngagedEnemies)
+		{
+			AMythosEnemyBase* Enemy = EnemyPtr.Get();
+			if (Enemy && Enemy->ThreatTable.Contains(Healed))
+			{
+				Fighting.Add(Enemy);
+			}
+		}
+
+		const float SplitThreat = Fighting.Num() > 0 ? Event.Amount * HealThreatScale / Fighting.Num() : 0.0f;
+		for (AMythosEnemyBase* Enemy : Fighting)
+		{
+			Enemy->ThreatTable.AddThreat(Source, SplitThreat, Now, DecayHalfLife);
+		}
+	}
+	PendingEvents.Reset();
+
+	// Decay is lazy, this only forgets enemies whose tables ran empty
+	TimeSinceCleanup += DeltaTime;
+	if (TimeSinceCleanup < 1.0f)
+	{
+		return;
+	}
+	TimeSinceCleanup = 0.0f;
+
+	for (int32 Index = EngagedEnemies.Num() - 1; Index >= 0; --Index)
+	{
+		AMythosEnemyBase* Enemy = EngagedEnemies[Index].Get();
+		if (Enemy)
+		{
+			Enemy->ThreatTable.Decay(Now, DecayHalfLife);
+		}
+		if (!Enemy || Enemy->ThreatTable.IsEmpty())
+		{
+			EngagedEnemies.RemoveAtSwap(Index, EAllowShrinking::No);
+		}
+	}
+}
+
+bool UMythosThreatSubsystem::IsTickable() const
+{
+	return PendingEvents.Num() > 0 || EngagedEnemies.Num() > 0;
+}
+
+TStatId UMythosThreatSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosThreatSubsystem, STATGROUP_Tickables);
+}
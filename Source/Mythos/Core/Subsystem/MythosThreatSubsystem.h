@@ -0,0 +1,68 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MythosThreatSubsystem.generated.h"
+
+class AMythosEnemyBase;
+
+/**
+ * Feeds enemy threat tables from the damage and heal execution calculations.
+ * Executions only queue an event; all events of a frame are applied in one pass at the end of it,
+ * so a 40 target AoE is 40 array appends and one loop rather than 40 callbacks.
+ */
+UCLASS(Config = Game)
+class MYTHOS_API UMythosThreatSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Source damaged Target, server only
+	static void QueueDamageThreat(AActor* Target, AActor* Source, float Amount);
+
+	// Healer healed Target, enemies fighting Target get angry at Healer
+	static void QueueHealThreat(AActor* Target, AActor* Healer, float Amount);
+
+	float GetDecayHalfLife() const { return DecayHalfLife; }
+
+	// Stop tracking an enemy's table, e.g. when it goes back to the pool
+	void UnregisterEnemy(AMythosEnemyBase* Enemy);
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	// seconds for threat to fall to half
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	float DecayHalfLife = 10.0f;
+
+	// threat per point of damage
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	float DamageThreatScale = 1.0f;
+
+	// threat per point of healing, split over the enemies fighting the healed target
+	UPROPERTY(EditAnywhere, Config, Category = "Mythos|AI")
+	float HealThreatScale = 0.5f;
+
+private:
+	struct FThreatEvent
+	{
+		TWeakObjectPtr<AActor> Target;
+		TWeakObjectPtr<AActor> Source;
+		float Amount = 0.0f;
+		bool bHeal = false;
+	};
+
+	static void QueueEvent(AActor* Target, AActor* Source, float Amount, bool bHeal);
+
+	TArray<FThreatEvent> PendingEvents;
+
+	// enemies with a non-empty table, the ones heal threat can reach
+	TArray<TWeakObjectPtr<AMythosEnemyBase>> EngagedEnemies;
+
+	float TimeSinceCleanup = 0.0f;
+};
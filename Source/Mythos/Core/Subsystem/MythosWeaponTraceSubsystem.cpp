@@ -0,0 +1,130 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "Core/Subsystem/MythosWeaponTraceSubsystem.h"
+#include "Core/Profiling/MythosStats.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+
+void UMythosWeaponTraceSubsystem::BeginSwing(USkeletalMeshComponent* Mesh, const UObject* Key, const FMythosWeaponTraceSettings& Settings)
+{
+	if (!Mesh || !Mesh->GetOwner())
+	{
+		return;
+	}
+
+	int32 Index = FindSwing(Mesh, Key);
+	if (Index == INDEX_NONE)
+	{
+		Index = Swings.AddDefaulted();
+	}
+
+	FSwing& Swing = Swings[Index];
+	Swing.Mesh = Mesh;
+	Swing.Key = Key;
+	Swing.Settings = Settings;
+	Swing.PrevStart = Mesh->GetSocketLocation(Settings.StartSocket);
+	Swing.PrevEnd = Mesh->GetSocketLocation(Settings.EndSocket);
+	Swing.HitActors.Reset();
+}
+
+void UMythosWeaponTraceSubsystem::EndSwing(USkeletalMeshComponent* Mesh, const UObject* Key)
+{
+	const int32 Index = FindSwing(Mesh, Key);
+	if (Index != INDEX_NONE)
+	{
+		Swings.RemoveAtSwap(Index, EAllowShrinking::No);
+	}
+}
+
+int32 UMythosWeaponTraceSubsystem::FindSwing(const USkeletalMeshComponent* Mesh, const UObject* Key) const
+{
+	return Swings.IndexOfByPredicate([Mesh, Key](const FSwing& Swing)
+	{
+		return Swing.Key == Key && Swing.Mesh.Get() == Mesh;
+	});
+}
+
+void UMythosWeaponTraceSubsystem::Tick(float DeltaTime)
+{
+	CSV_SCOPED_TIMING_STAT(Mythos, WeaponTraceTick);
+
+	// Runs after the tick groups, so every mesh already has this frame's pose
+	TArray<FHitResult> HitScratch;
+	for (int32 Index = Swings.Num() - 1; Index >= 0; --Index)
+	{
+		if (!Swings[Index].Mesh.IsValid())
+		{
+			Swings.RemoveAtSwap(Index, EAllowShrinking::No);
+			continue;
+		}
+
+		TraceSwing(Swings[Index], HitScratch);
+	}
+}
+
+void UMythosWeaponTraceSubsystem::TraceSwing(FSwing& Swing, TArray<FHitResult>& HitScratch) const
+{
+	USkeletalMeshComponent* Mesh = Swing.Mesh.Get();
+	AActor* Owner = Mesh->GetOwner();
+	const FMythosWeaponTraceSettings& Settings = Swing.Settings;
+
+	const FVector CurrStart = Mesh->GetSocketLocation(Settings.StartSocket);
+	const FVector CurrEnd = Mesh->GetSocketLocation(Settings.EndSocket);
+
+	// Sub-step by how far the blade turned since last frame
+	const FVector PrevDir = (Swing.PrevEnd - Swing.PrevStart).GetSafeNormal();
+	const FVector CurrDir = (CurrEnd - CurrStart).GetSafeNormal();
+	const float Degrees = FMath::RadiansToDegrees(FMath::Acos(FMath::Clamp(FVector::DotProduct(PrevDir, CurrDir), -1.0f, 1.0f)));
+	const int32 SubSteps = FMath::Clamp(FMath::CeilToInt(Degrees / Settings.DegreesPerSubStep), 1, Settings.MaxSubSteps);
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(MythosWeaponTrace), false, Owner);
+	const FCollisionObjectQueryParams ObjectParams(ECC_Pawn);
+	const FCollisionShape Sphere = FCollisionShape::MakeSphere(Settings.TraceRadius);
+
+	UWorld* World = GetWorld();
+	for (int32 Step = 1; Step <= SubSteps; ++Step)
+	{
+		// Sweep the blade along its length at each intermediate pose
+		const float Alpha = static_cast<float>(Step) / SubSteps;
+		const FVector BladeStart = FMath::Lerp(Swing.PrevStart, CurrStart, Alpha);
+		const FVector BladeEnd = FMath::Lerp(Swing.PrevEnd, CurrEnd, Alpha);
+
+		HitScratch.Reset();
+		World->SweepMultiByObjectType(HitScratch, BladeStart, BladeEnd, FQuat::Identity, ObjectParams, Sphere, QueryParams);
+
+		for (const FHitResult& Hit : HitScratch)
+		{
+			AActor* HitActor = Hit.GetActor();
+			if (!HitActor || Swing.HitActors.Contains(HitActor))
+			{
+				continue;
+			}
+			Swing.HitActors.Add(HitActor);
+
+			if (Settings.EventTag.IsValid())
+			{
+				FGameplayEventData Payload;
+				Payload.EventTag = Settings.EventTag;
+				Payload.Instigator = Owner;
+				Payload.Target = HitActor;
+				Payload.TargetData = UAbilitySystemBlueprintLibrary::AbilityTargetDataFromHitResult(Hit);
+				UAbilitySystemBlueprintLibrary::SendGameplayEventToActor(Owner, Settings.EventTag, Payload);
+			}
+		}
+	}
+
+	Swing.PrevStart = CurrStart;
+	Swing.PrevEnd = CurrEnd;
+}
+
+bool UMythosWeaponTraceSubsystem::IsTickable() const
+{
+	return Swings.Num() > 0;
+}
+
+TStatId UMythosWeaponTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UMythosWeaponTraceSubsystem, STATGROUP_Tickables);
+}
@@ -0,0 +1,86 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayTagContainer.h"
+#include "MythosWeaponTraceSubsystem.generated.h"
+
+class USkeletalMeshComponent;
+
+/**
+ * How a weapon is traced during a swing
+ */
+USTRUCT(BlueprintType)
+struct FMythosWeaponTraceSettings
+{
+	GENERATED_BODY()
+
+	// blade base and tip sockets on the owner's mesh
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|WeaponTrace")
+	FName StartSocket = TEXT("weapon_start");
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|WeaponTrace")
+	FName EndSocket = TEXT("weapon_end");
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|WeaponTrace", meta = (ClampMin = "0.0"))
+	float TraceRadius = 10.0f;
+
+	// a new sub-step is traced every time the blade turns this many degrees
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|WeaponTrace", meta = (ClampMin = "1.0"))
+	float DegreesPerSubStep = 15.0f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|WeaponTrace", meta = (ClampMin = "1"))
+	int32 MaxSubSteps = 8;
+
+	// gameplay event sent to the owner for each actor hit, e.g. LightAttack.TraceEnemy
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Mythos|WeaponTrace")
+	FGameplayTag EventTag;
+};
+
+/**
+ * Traces every active weapon swing in the world in one pass per frame.
+ * Each swing sweeps the blade from the previous frame's pose to the current one, sub-stepped by how far
+ * the blade turned, so fast swings don't tunnel at low frame rates. An actor is only reported once per swing.
+ */
+UCLASS()
+class MYTHOS_API UMythosWeaponTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	// Start tracing; Key tells apart several swings on the same mesh (the notify state that started it)
+	void BeginSwing(USkeletalMeshComponent* Mesh, const UObject* Key, const FMythosWeaponTraceSettings& Settings);
+
+	void EndSwing(USkeletalMeshComponent* Mesh, const UObject* Key);
+
+	int32 GetNumActiveSwings() const { return Swings.Num(); }
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override;
+	virtual TStatId GetStatId() const override;
+
+private:
+	struct FSwing
+	{
+		TWeakObjectPtr<USkeletalMeshComponent> Mesh;
+		const UObject* Key = nullptr;
+		FMythosWeaponTraceSettings Settings;
+
+		// blade pose traced last frame
+		FVector PrevStart = FVector::ZeroVector;
+		FVector PrevEnd = FVector::ZeroVector;
+
+		// actors already hit by this swing, swings only hit a handful
+		TArray<TWeakObjectPtr<AActor>, TInlineAllocator<8>> HitActors;
+	};
+
+	int32 FindSwing(const USkeletalMeshComponent* Mesh, const UObject* Key) const;
+
+	// Sweep one swing and send an event for every new actor hit
+	void TraceSwing(FSwing& Swing, TArray<FHitResult>& HitScratch) const;
+
+	TArray<FSwing> Swings;
+};
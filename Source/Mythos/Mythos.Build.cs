@@ -1,5 +1,9 @@
 // Copyright Epic Games, Inc. All Rights Reserved.
 
+using System.IO;
+using System.Linq;
+using System.Text.RegularExpressions;
+using EpicGames.Core;
 using UnrealBuildTool;
 
 public class Mythos : ModuleRules
@@ -23,7 +27,15 @@ public class Mythos : ModuleRules
 			"GameplayTasks"
 		});
 
-		PrivateDependencyModuleNames.AddRange(new string[] { });
+		PrivateDependencyModuleNames.AddRange(new string[] {
+			"Json"
+		});
+
+		// PIE driven automation tests under Tests/
+		if (Target.bBuildEditor)
+		{
+			PrivateDependencyModuleNames.Add("UnrealEd");
+		}
 
 		PublicIncludePaths.AddRange(new string[] {
 			"Mythos",
@@ -43,5 +55,34 @@ public class Mythos : ModuleRules
 		// PrivateDependencyModuleNames.Add("OnlineSubsystem");
 
 		// To include OnlineSubsystemSteam, add it to the plugins section in your uproject file with the Enabled attribute set to true
+
+		CheckNativeGameplayTags();
+	}
+
+	// Fail the build when the native tag registry and DefaultGameplayTags.ini disagree
+	private void CheckNativeGameplayTags()
+	{
+		string IniPath = Path.Combine(ModuleDirectory, "..", "..", "Config", "DefaultGameplayTags.ini");
+		string RegistryPath = Path.Combine(ModuleDirectory, "Core", "AbilitySystem", "Tags", "MythosGameplayTags.cpp");
+		string PatternPath = Path.Combine(ModuleDirectory, "..", "..", "Tools", "GameplayTagPattern.txt");
+		if (!File.Exists(IniPath) || !File.Exists(RegistryPath) || !File.Exists(PatternPath))
+		{
+			return;
+		}
+
+		// Same pattern Tools/GenerateGameplayTags.py uses
+		string TagPattern = File.ReadAllText(PatternPath).Trim();
+		var IniTags = Regex.Matches(File.ReadAllText(IniPath), TagPattern, RegexOptions.Multiline)
+			.Select(Match => Match.Groups[1].Value).ToHashSet();
+		var NativeTags = Regex.Matches(File.ReadAllText(RegistryPath), "UE_DEFINE_GAMEPLAY_TAG(?:_COMMENT)?\\(\\s*\\w+\\s*,\\s*\"([^\"]+)\"")
+			.Select(Match => Match.Groups[1].Value).ToHashSet();
+
+		var Missing = IniTags.Except(NativeTags).OrderBy(Tag => Tag).ToList();
+		var Extra = NativeTags.Except(IniTags).OrderBy(Tag => Tag).ToList();
+		if (Missing.Count > 0 || Extra.Count > 0)
+		{
+			throw new BuildException("MythosGameplayTags is out of sync with DefaultGameplayTags.ini (missing: {0}; not in ini: {1}). Run Tools/GenerateGameplayTags.py.",
+				string.Join(", ", Missing), string.Join(", ", Extra));
+		}
 	}
 }
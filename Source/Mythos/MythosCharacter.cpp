@@ -12,7 +12,10 @@
 #include "InputActionValue.h"
 #include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
 #include "Core/AbilitySystem/Component/MythosAttributeSet.h"
+#include "Core/Profiling/MythosMemory.h"
 #include "GameplayTagAssetInterface.h"
+#include "Core/Subsystem/MythosRotationSubsystem.h"
+#include "Core/AbilitySystem/Tags/MythosGameplayTags.h"
 
 DEFINE_LOG_CATEGORY(LogTemplateCharacter);
 
@@ -51,6 +54,7 @@ AMythosCharacter::AMythosCharacter()
 	FollowCamera->bUsePawnControlRotation = false;
 
 	// GASAbilitySystemComponent
+	LLM_SCOPE_BYTAG(Mythos_AbilitySystem);
 	AbilitySystemComponent = CreateDefaultSubobject<UMythosAbilitySystemComponent>(TEXT("AbilitySystemComponent"));
 	AbilitySystemComponent->SetIsReplicated(true);
 	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
@@ -81,6 +85,17 @@ void AMythosCharacter::PostInitializeComponents()
 			AttributeSet->OnGameplayEffectApplied.AddDynamic(this, &AMythosCharacter::HandleGameplayEffectApplied);
 		}
 
+		// Track the hot-path filter tags as bits, counts include loose and granted tags
+		for (const FGameplayTag& TrackedTag : MythosTagBits::GetTrackedTags())
+		{
+			AbilitySystemComponent->RegisterGameplayTagEvent(TrackedTag, EGameplayTagEventType::NewOrRemoved)
+				.AddUObject(this, &AMythosCharacter::HandleTrackedTagChanged);
+			if (AbilitySystemComponent->HasMatchingGameplayTag(TrackedTag))
+			{
+				TagBits |= MythosTagBits::GetMask(TrackedTag);
+			}
+		}
+
 		// Initialize character type tags
 		InitializeCharacterTypeTags();
 	}
@@ -179,6 +194,12 @@ void AMythosCharacter::GetOwnedGameplayTags(FGameplayTagContainer& TagContainer)
 
 bool AMythosCharacter::HasMatchingGameplayTag(FGameplayTag TagToCheck) const
 {
+	// Tracked tags are answered from the bitset
+	if (const MythosTagBits::FMask Mask = MythosTagBits::GetMask(TagToCheck))
+	{
+		return HasAnyTagBits(Mask);
+	}
+
 	if (AbilitySystemComponent)
 	{
 		return AbilitySystemComponent->HasMatchingGameplayTag(TagToCheck);
@@ -261,80 +282,55 @@ void AMythosCharacter::HandleGameplayEffectApplied(AActor* Source, FString Effec
 	OnGameplayEffectApplied.Broadcast(Source, EffectName, Magnitude);
 }
 
+void AMythosCharacter::HandleTrackedTagChanged(const FGameplayTag Tag, int32 NewCount)
+{
+	const MythosTagBits::FMask Mask = MythosTagBits::GetMask(Tag);
+	if (NewCount > 0)
+	{
+		TagBits |= Mask;
+	}
+	else
+	{
+		TagBits &= ~Mask;
+	}
+}
+
 void AMythosCharacter::InitializeCharacterTypeTags()
 {
 	if (AbilitySystemComponent)
 	{
 		// Add Player tag by default
-		FGameplayTag PlayerTag = FGameplayTag::RequestGameplayTag(TEXT("CharacterType.Player"));
-		AbilitySystemComponent->AddLooseGameplayTag(PlayerTag);
+		AbilitySystemComponent->AddLooseGameplayTag(MythosGameplayTags::CharacterType_Player);
 	}
 }
 
 void AMythosCharacter::SmoothRotateToDirection(const FVector& TargetDirection, float Duration)
 {
-	// Stop any existing smooth rotation
-	StopSmoothRotation();
-
 	// Normalize the target direction
 	FVector NormalizedDirection = TargetDirection.GetSafeNormal();
 	if (NormalizedDirection.IsNearlyZero())
 	{
 		UE_LOG(LogTemplateCharacter, Warning, TEXT("SmoothRotateToDirection: Target direction is nearly zero"));
+		StopSmoothRotation();
 		return;
 	}
 
-	// Calculate target rotation from direction
-	FRotator TargetRotation = NormalizedDirection.Rotation();
-	
-	// Set up smooth rotation
-	SmoothRotationStart = GetActorRotation();
-	SmoothRotationTarget = TargetRotation;
-	SmoothRotationDuration = FMath::Max(Duration, 0.1f); // Minimum duration of 0.1 seconds
-	SmoothRotationElapsed = 0.0f;
-
-	UE_LOG(LogTemplateCharacter, Log, TEXT("Starting smooth rotation: Start=%s, Target=%s, Duration=%.2f"), 
-		*SmoothRotationStart.ToString(), *SmoothRotationTarget.ToString(), SmoothRotationDuration);
-
-	// Start the timer for smooth rotation updates
-	GetWorld()->GetTimerManager().SetTimer(SmoothRotationTimerHandle, this, &AMythosCharacter::UpdateSmoothRotation, 
-		GetWorld()->GetDeltaSeconds(), true);
-}
-
-void AMythosCharacter::StopSmoothRotation()
-{
-	if (SmoothRotationTimerHandle.IsValid())
+	// Hand the rotation to the shared driver, it restarts our slot if we are already rotating
+	if (UMythosRotationSubsystem* RotationSubsystem = GetWorld()->GetSubsystem<UMythosRotationSubsystem>())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(SmoothRotationTimerHandle);
-		UE_LOG(LogTemplateCharacter, Log, TEXT("Stopped smooth rotation"));
+		// Minimum duration of 0.1 seconds
+		RotationSubsystem->StartRotation(this, NormalizedDirection.ToOrientationQuat(), FMath::Max(Duration, 0.1f));
 	}
 }
 
-void AMythosCharacter::UpdateSmoothRotation()
+void AMythosCharacter::StopSmoothRotation()
 {
-	// Update elapsed time
-	SmoothRotationElapsed += GetWorld()->GetDeltaSeconds();
-	
-	// Calculate interpolation alpha (0.0 to 1.0)
-	float Alpha = FMath::Clamp(SmoothRotationElapsed / SmoothRotationDuration, 0.0f, 1.0f);
-	
-	// Use smooth interpolation (ease in/out)
-	float SmoothAlpha = FMath::InterpEaseInOut(0.0f, 1.0f, Alpha, 2.0f);
-	
-	// Interpolate rotation
-	FRotator NewRotation = FMath::Lerp(SmoothRotationStart, SmoothRotationTarget, SmoothAlpha);
-	
-	// Apply the rotation
-	SetActorRotation(NewRotation);
-	
-	UE_LOG(LogTemplateCharacter, Log, TEXT("Smooth rotation update: Alpha=%.2f, Rotation=%s"), Alpha, *NewRotation.ToString());
-	
-	// Check if rotation is complete
-	if (Alpha >= 1.0f)
+	if (SmoothRotationSlot != INDEX_NONE)
 	{
-		// Set final rotation exactly
-		SetActorRotation(SmoothRotationTarget);
-		StopSmoothRotation();
-		UE_LOG(LogTemplateCharacter, Log, TEXT("Smooth rotation completed"));
+		if (UMythosRotationSubsystem* RotationSubsystem = GetWorld()->GetSubsystem<UMythosRotationSubsystem>())
+		{
+			RotationSubsystem->StopRotation(SmoothRotationSlot);
+		}
+		SmoothRotationSlot = INDEX_NONE;
 	}
 }
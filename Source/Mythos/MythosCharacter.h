@@ -9,6 +9,7 @@
 #include "Core/AbilitySystem/Component/MythosAttributeSet.h"
 #include "GameplayTagAssetInterface.h"
 #include "GameplayTags.h"
+#include "Core/AbilitySystem/Tags/MythosTagBits.h"
 #include "MythosCharacter.generated.h"
 
 class USpringArmComponent;
@@ -125,6 +126,10 @@ public:
 	virtual bool HasAnyMatchingGameplayTags(const FGameplayTagContainer& TagContainer) const override;
 	virtual bool HasAllMatchingGameplayTags(const FGameplayTagContainer& TagContainer) const override;
 
+	// Bitset of the tracked CharacterType.* / State.* tags, see MythosTagBits
+	FORCEINLINE MythosTagBits::FMask GetTagBits() const { return TagBits; }
+	FORCEINLINE bool HasAnyTagBits(MythosTagBits::FMask Mask) const { return (TagBits & Mask) != 0; }
+
 	// delegate
 	DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnHealthChangedDelegate, float, OldHealth, float, NewHealth, float, MaxHealth);
 	UPROPERTY(BlueprintAssignable, Category = "Mythos|Character|Attributes")
@@ -166,15 +171,16 @@ protected:
 	UFUNCTION()
 	void HandleGameplayEffectApplied(AActor* Source, FString EffectName, float Magnitude);
 
+	// keeps TagBits in sync with the ASC tag counts
+	void HandleTrackedTagChanged(const FGameplayTag Tag, int32 NewCount);
+
 private:
-	// Smooth rotation variables
-	FTimerHandle SmoothRotationTimerHandle;
-	FRotator SmoothRotationStart;
-	FRotator SmoothRotationTarget;
-	float SmoothRotationDuration;
-	float SmoothRotationElapsed;
-
-	// Smooth rotation update function
-	void UpdateSmoothRotation();
+	friend class UMythosRotationSubsystem;
+
+	// Slot in UMythosRotationSubsystem while a smooth rotation is running, INDEX_NONE otherwise
+	int32 SmoothRotationSlot = INDEX_NONE;
+
+	// one bit per MythosTagBits tracked tag
+	MythosTagBits::FMask TagBits = 0;
 };
 
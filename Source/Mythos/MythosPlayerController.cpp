@@ -5,6 +5,18 @@
 #include "EnhancedInputSubsystems.h"
 #include "Engine/LocalPlayer.h"
 #include "InputMappingContext.h"
+#include "Core/Profiling/MythosStats.h"
+#include "Core/AbilitySystem/Character/MythosEnemyBase.h"
+#include "Core/AbilitySystem/Component/MythosAbilitySystemComponent.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "GameFramework/PlayerState.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "EngineUtils.h"
 
 void AMythosPlayerController::SetupInputComponent()
 {
@@ -22,7 +34,26 @@ void AMythosPlayerController::SetupInputComponent()
 
 bool AMythosPlayerController::GetMouseWorldPosition(FVector& WorldLocation, FVector& WorldDirection, FHitResult& HitResult) const
 {
+	MYTHOS_SCOPE_STAT(MouseWorldPosition);
+
+#if UE_SERVER
+	// No cursor on a dedicated server
+	return false;
+#else
 	if (!IsLocalController()) return false;
+
+	// bots have no cursor, report the scripted aim point as if the cursor were over it
+	if (bBotMode)
+	{
+		WorldDirection = FVector::DownVector;
+		WorldLocation = BotAimPoint - WorldDirection * 1000.f;
+		HitResult = FHitResult(BotAimPoint, FVector::UpVector);
+		HitResult.bBlockingHit = true;
+		HitResult.TraceStart = WorldLocation;
+		HitResult.TraceEnd = BotAimPoint;
+		return true;
+	}
+
 	// get mouse world position and direction
 	if (DeprojectMousePositionToWorld(WorldLocation, WorldDirection))
 	{
@@ -35,6 +66,7 @@ bool AMythosPlayerController::GetMouseWorldPosition(FVector& WorldLocation, FVec
 		}
 	}
 	return false;
+#endif
 }
 
 void AMythosPlayerController::BeginPlay()
@@ -50,4 +82,156 @@ void AMythosPlayerController::BeginPlay()
 	FInputModeGameAndUI InputMode;
 	InputMode.SetLockMouseToViewportBehavior(EMouseLockMode::DoNotLock);
 	SetInputMode(InputMode);
+
+	// Load-test bot, see the class comment
+	if (IsLocalController() && FParse::Param(FCommandLine::Get(), TEXT("MythosBot")))
+	{
+		bBotMode = true;
+		FParse::Value(FCommandLine::Get(), TEXT("MythosBotId="), BotId);
+		FParse::Value(FCommandLine::Get(), TEXT("MythosBotSeconds="), BotDuration);
+		if (!FParse::Value(FCommandLine::Get(), TEXT("MythosBotReport="), BotReportPath))
+		{
+			BotReportPath = FPaths::ProjectSavedDir() / TEXT("Bots") / FString::Printf(TEXT("Bot-%d.json"), BotId);
+		}
+
+		// Spread the bots' casts instead of all of them firing on the same frame
+		BotCastTimer = FMath::FRandRange(0.0f, BotCastInterval);
+	}
+}
+
+void AMythosPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bBotMode)
+	{
+		WriteBotReport();
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AMythosPlayerController::PlayerTick(float DeltaTime)
+{
+	Super::PlayerTick(DeltaTime);
+
+	if (!bBotMode)
+	{
+		return;
+	}
+
+	BotTime += DeltaTime;
+	if (BotDuration > 0.0f && BotTime >= BotDuration)
+	{
+		WriteBotReport();
+		FPlatformMisc::RequestExit(false);
+		return;
+	}
+
+	APawn* BotPawn = GetPawn();
+	if (!BotPawn)
+	{
+		return;
+	}
+
+	// Bind here, the pawn (and its ASC) arrives after BeginPlay
+	if (UMythosAbilitySystemComponent* ASC = Cast<UMythosAbilitySystemComponent>(UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(BotPawn)))
+	{
+		if (!ASC->OnAbilityPredictionRejected.IsBoundToObject(this))
+		{
+			ASC->OnAbilityPredictionRejected.AddUObject(this, &AMythosPlayerController::HandleBotPredictionRejected);
+		}
+	}
+
+	// Wander between random points so movement replicates like a real player's
+	const FVector PawnLocation = BotPawn->GetActorLocation();
+	if (BotMoveTarget.IsZero() || FVector::DistSquared2D(PawnLocation, BotMoveTarget) < FMath::Square(100.0f))
+	{
+		const FVector2D Offset = FMath::RandPointInCircle(BotWanderRadius);
+		BotMoveTarget = PawnLocation + FVector(Offset.X, Offset.Y, 0.0f);
+	}
+	BotPawn->AddMovementInput((BotMoveTarget - PawnLocation).GetSafeNormal2D());
+
+	BotPingTimer -= DeltaTime;
+	if (BotPingTimer <= 0.0f && PlayerState)
+	{
+		BotPingTimer = 1.0f;
+		BotPingSamples.Add(PlayerState->GetPingInMilliseconds());
+	}
+
+	BotCastTimer -= DeltaTime;
+	if (BotCastTimer <= 0.0f)
+	{
+		BotCastTimer += BotCastInterval;
+		BotCast();
+	}
+}
+
+void AMythosPlayerController::BotCast()
+{
+	APawn* BotPawn = GetPawn();
+	UAbilitySystemComponent* ASC = UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(BotPawn);
+	if (!ASC)
+	{
+		return;
+	}
+
+	// Aim at the nearest enemy, or somewhere around the pawn
+	const FVector PawnLocation = BotPawn->GetActorLocation();
+	float BestDistanceSquared = FMath::Square(BotAimRange);
+	BotAimPoint = PawnLocation + FVector(FMath::RandPointInCircle(BotWanderRadius), 0.0f);
+	for (TActorIterator<AMythosEnemyBase> It(GetWorld()); It; ++It)
+	{
+		const float DistanceSquared = FVector::DistSquared(PawnLocation, It->GetActorLocation());
+		if (!It->IsInPool() && DistanceSquared < BestDistanceSquared)
+		{
+			BestDistanceSquared = DistanceSquared;
+			BotAimPoint = It->GetActorLocation();
+		}
+	}
+
+	const TArray<FGameplayAbilitySpec>& Specs = ASC->GetActivatableAbilities();
+	if (Specs.Num() == 0)
+	{
+		return;
+	}
+
+	BotNextAbility = (BotNextAbility + 1) % Specs.Num();
+	++BotCastAttempts;
+	BotCastsActivated += ASC->TryActivateAbility(Specs[BotNextAbility].Handle) ? 1 : 0;
+}
+
+void AMythosPlayerController::HandleBotPredictionRejected()
+{
+	++BotPredictionRejections;
+}
+
+void AMythosPlayerController::WriteBotReport()
+{
+	if (bBotReportWritten)
+	{
+		return;
+	}
+	bBotReportWritten = true;
+
+	TArray<float> Pings = BotPingSamples;
+	Pings.Sort();
+	const auto Percentile = [&Pings](float P) { return Pings.Num() > 0 ? Pings[FMath::Clamp(FMath::CeilToInt(P * Pings.Num()) - 1, 0, Pings.Num() - 1)] : 0.0f; };
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetNumberField(TEXT("bot"), BotId);
+	Report->SetNumberField(TEXT("seconds"), BotTime);
+	Report->SetNumberField(TEXT("castAttempts"), BotCastAttempts);
+	Report->SetNumberField(TEXT("castsActivated"), BotCastsActivated);
+	Report->SetNumberField(TEXT("predictionRejections"), BotPredictionRejections);
+	Report->SetNumberField(TEXT("pingP50"), Percentile(0.5f));
+	Report->SetNumberField(TEXT("pingP99"), Percentile(0.99f));
+	Report->SetNumberField(TEXT("pingMax"), Percentile(1.0f));
+	Report->SetNumberField(TEXT("pingSamples"), Pings.Num());
+
+	FString Json;
+	const TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Json);
+	FJsonSerializer::Serialize(Report, Writer);
+	if (!FFileHelper::SaveStringToFile(Json, *BotReportPath))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Bot %d: could not write %s"), BotId, *BotReportPath);
+	}
 }
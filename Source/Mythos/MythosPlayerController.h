@@ -11,6 +11,12 @@ class UInputMappingContext;
 /**
  *  Basic PlayerController class for a third person game
  *  Manages input mappings
+ *
+ *  Started with -MythosBot the local controller becomes a headless load-test bot: cursor input is
+ *  replaced by scripted aim points (nearest enemy, else a random point), the pawn wanders and the
+ *  granted abilities are cast in turn. Ping and server rejections are written to a JSON report
+ *  (-MythosBotReport=<Path>) after -MythosBotSeconds=<N>, then the process exits.
+ *  Tools/RunBots.py launches many of these against a local dedicated server and aggregates the reports.
  */
 UCLASS(abstract)
 class AMythosPlayerController : public APlayerController
@@ -27,8 +33,26 @@ protected:
 	virtual void SetupInputComponent() override;
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void PlayerTick(float DeltaTime) override;
+
+	/** seconds between two scripted casts of a bot */
+	UPROPERTY(EditDefaultsOnly, Category = "Mythos|Bot")
+	float BotCastInterval = 1.5f;
+
+	/** bots aim at the nearest enemy within this range, otherwise at a random point */
+	UPROPERTY(EditDefaultsOnly, Category = "Mythos|Bot")
+	float BotAimRange = 1500.0f;
+
+	/** radius around the pawn for random aim and wander points */
+	UPROPERTY(EditDefaultsOnly, Category = "Mythos|Bot")
+	float BotWanderRadius = 800.0f;
 
 public:
+	/** true when this controller is driven by the bot script instead of a player */
+	UFUNCTION(BlueprintCallable, Category = "Mythos|Bot")
+	bool IsBot() const { return bBotMode; }
+
 	/** mouse world position */
 	UFUNCTION(BlueprintCallable, Category = "Mythos|Mouse")
 
@@ -43,4 +67,30 @@ public:
 
 	bool GetMouseWorldPosition(FVector& WorldLocation, FVector& WorldDirection, FHitResult& HitResult) const;
 
+private:
+	/** Pick a new aim point and activate the next granted ability */
+	void BotCast();
+
+	void WriteBotReport();
+
+	void HandleBotPredictionRejected();
+
+	bool bBotMode = false;
+	bool bBotReportWritten = false;
+	int32 BotId = 0;
+	FString BotReportPath;
+
+	/** 0 runs until the connection closes */
+	float BotDuration = 0.0f;
+	float BotTime = 0.0f;
+	float BotCastTimer = 0.0f;
+	float BotPingTimer = 0.0f;
+	int32 BotNextAbility = 0;
+	FVector BotAimPoint = FVector::ZeroVector;
+	FVector BotMoveTarget = FVector::ZeroVector;
+
+	int32 BotCastAttempts = 0;
+	int32 BotCastsActivated = 0;
+	int32 BotPredictionRejections = 0;
+	TArray<float> BotPingSamples;
 };
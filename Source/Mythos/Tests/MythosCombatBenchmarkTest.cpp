@@ -0,0 +1,149 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "Core/Subsystem/MythosCombatBenchmarkSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Editor.h"
+#include "Tests/AutomationCommon.h"
+#include "Tests/AutomationEditorCommon.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Engine/World.h"
+
+namespace MythosCombatBenchmarkTest
+{
+	UMythosCombatBenchmarkSubsystem* GetBenchmark()
+	{
+		UWorld* World = GEditor ? GEditor->PlayWorld.Get() : nullptr;
+		return World && World->HasBegunPlay() ? World->GetSubsystem<UMythosCombatBenchmarkSubsystem>() : nullptr;
+	}
+
+	struct FState
+	{
+		double StepStartTime = 0.0;
+		bool bFailed = false;
+		FString ReportPath;
+	};
+}
+
+// A small benchmark grid in PIE on an empty map: every scheduled cast has to activate, the casts have to
+// query targets and run executions, enemy abilities must not keep an instance per enemy, and the JSON report has to be written
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMythosCombatBenchmarkTest, "Mythos.Benchmark.Combat",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMythosCombatBenchmarkTest::RunTest(const FString& Parameters)
+{
+	using namespace MythosCombatBenchmarkTest;
+
+	if (!FAutomationEditorCommonUtils::CreateNewMap())
+	{
+		AddError(TEXT("Could not create an empty map"));
+		return false;
+	}
+
+	FRequestPlaySessionParams PlayParams;
+	GEditor->RequestPlaySession(PlayParams);
+
+	TSharedRef<FState> State = MakeShared<FState>();
+	State->StepStartTime = FPlatformTime::Seconds();
+	State->ReportPath = FPaths::AutomationTransientDir() / TEXT("MythosCombatBenchmarkTest.json");
+	IFileManager::Get().Delete(*State->ReportPath);
+
+	// Wait for PIE, then start a 4x4 grid
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		if (UMythosCombatBenchmarkSubsystem* Benchmark = GetBenchmark())
+		{
+			Benchmark->SetReportPath(State->ReportPath);
+			Benchmark->StartBenchmark(4, 4, 3.0f);
+			if (!Benchmark->IsRunning())
+			{
+				AddError(TEXT("The benchmark did not start, see LogMythosBenchmark"));
+				State->bFailed = true;
+			}
+			State->StepStartTime = FPlatformTime::Seconds();
+			return true;
+		}
+
+		if (FPlatformTime::Seconds() - State->StepStartTime > 30.0)
+		{
+			AddError(TEXT("PIE never started"));
+			State->bFailed = true;
+			return true;
+		}
+		return false;
+	}));
+
+	// Warmup plus recording, the report is written when it stops
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State]()
+	{
+		if (State->bFailed)
+		{
+			return true;
+		}
+
+		const UMythosCombatBenchmarkSubsystem* Benchmark = GetBenchmark();
+		if (Benchmark && Benchmark->IsRunning())
+		{
+			if (FPlatformTime::Seconds() - State->StepStartTime > 60.0)
+			{
+				AddError(TEXT("The benchmark did not finish within 60s"));
+				State->bFailed = true;
+				return true;
+			}
+			return false;
+		}
+
+		FString Json;
+		TSharedPtr<FJsonObject> Report;
+		if (!FFileHelper::LoadFileToString(Json, *State->ReportPath)
+			|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Json), Report) || !Report.IsValid())
+		{
+			AddError(FString::Printf(TEXT("No readable report at %s"), *State->ReportPath));
+			return true;
+		}
+
+		const TSharedPtr<FJsonObject>* Combat = nullptr;
+		const TSharedPtr<FJsonObject>* Targeting = nullptr;
+		const TSharedPtr<FJsonObject>* AbilityObjects = nullptr;
+		if (!Report->TryGetObjectField(TEXT("combat"), Combat) || !Report->TryGetObjectField(TEXT("targetQueries"), Targeting)
+			|| !Report->TryGetObjectField(TEXT("abilities"), AbilityObjects))
+		{
+			AddError(TEXT("The report is missing combat, targetQueries or abilities"));
+			return true;
+		}
+
+		AddInfo(FString::Printf(TEXT("Report: %s"), *State->ReportPath));
+		TestTrue(TEXT("Casts were attempted"), (*Combat)->GetNumberField(TEXT("castAttempts")) > 0.0);
+		TestEqual(TEXT("Cast failures"), (*Combat)->GetNumberField(TEXT("castFailures")), 0.0);
+		TestTrue(TEXT("Abilities activated"), (*Combat)->GetNumberField(TEXT("activationsPerSecond")) > 0.0);
+		TestTrue(TEXT("Damage and heal executions ran"), (*Combat)->GetNumberField(TEXT("effectExecutionsPerSecond")) > 0.0);
+		TestTrue(TEXT("Effects were applied"), (*Combat)->GetNumberField(TEXT("effectApplicationsPerSecond")) > 0.0);
+		TestTrue(TEXT("Targets were queried"), (*Targeting)->GetNumberField(TEXT("queries")) > 0.0);
+		TestTrue(TEXT("Queries found targets"), (*Targeting)->GetNumberField(TEXT("targetsPerQuery")) > 0.0);
+
+		// Per actor instancing would leave one instance per granted ability, 4 per enemy
+		TestTrue(TEXT("Abilities were granted"), (*AbilityObjects)->GetNumberField(TEXT("granted")) >= Report->GetNumberField(TEXT("enemies")));
+		TestTrue(TEXT("Ability instances do not grow with the enemy count"),
+			(*AbilityObjects)->GetNumberField(TEXT("instances")) < Report->GetNumberField(TEXT("enemies")));
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([]()
+	{
+		GEditor->RequestEndPlayMap();
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
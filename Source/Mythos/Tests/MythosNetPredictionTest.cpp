@@ -0,0 +1,195 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS && WITH_EDITOR
+
+#include "Core/Subsystem/MythosNetReportSubsystem.h"
+#include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
+#include "Editor.h"
+#include "FileHelpers.h"
+#include "Settings/LevelEditorPlaySettings.h"
+#include "Tests/AutomationCommon.h"
+#include "GameFramework/PlayerController.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+
+namespace MythosNetPredictionTest
+{
+	UWorld* FindClientWorld()
+	{
+		for (const FWorldContext& Context : GEngine->GetWorldContexts())
+		{
+			UWorld* World = Context.World();
+			if (Context.WorldType == EWorldType::PIE && World && World->GetNetMode() == NM_Client)
+			{
+				return World;
+			}
+		}
+		return nullptr;
+	}
+
+	FGameplayAbilitySpec* FindLocalAbility(UWorld* World, const FGameplayTag& AbilityTag, UAbilitySystemComponent*& OutASC)
+	{
+		const APlayerController* PC = World ? World->GetFirstPlayerController() : nullptr;
+		OutASC = PC ? UAbilitySystemBlueprintLibrary::GetAbilitySystemComponent(PC->GetPawn()) : nullptr;
+		if (!OutASC)
+		{
+			return nullptr;
+		}
+
+		TArray<FGameplayAbilitySpec*> Specs;
+		OutASC->GetActivatableGameplayAbilitySpecsByAllMatchingTags(FGameplayTagContainer(AbilityTag), Specs);
+		return Specs.Num() > 0 ? Specs[0] : nullptr;
+	}
+
+	struct FState
+	{
+		double StepStartTime = 0.0;
+		bool bFailed = false;
+		bool bPreviousPredict = false;
+		TWeakObjectPtr<UWorld> ClientWorld;
+	};
+}
+
+// Listen server plus one client in PIE with emulated lag: the client's cost and cooldown have to land
+// locally well before a round trip, and the predicted cooldown has to block activating again
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMythosPredictedCostAndCooldownTest, "Mythos.Net.PredictedCostAndCooldown",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FMythosPredictedCostAndCooldownTest::RunTest(const FString& Parameters)
+{
+	using namespace MythosNetPredictionTest;
+
+	const UMythosNetReportSubsystem* Settings = GetDefault<UMythosNetReportSubsystem>();
+	// Skipped until a project configures its test map and ability, there is nothing to measure without them
+	if (!Settings->LatencyTestMap.IsValid() || !Settings->LatencyTestAbilityTag.IsValid())
+	{
+		AddWarning(TEXT("Skipped: set LatencyTestMap and LatencyTestAbilityTag for MythosNetReportSubsystem in DefaultGame.ini"));
+		return true;
+	}
+
+	const FGameplayTag AbilityTag = Settings->LatencyTestAbilityTag;
+	const int32 PktLagMs = Settings->LatencyTestPktLagMs;
+
+	if (!FEditorFileUtils::LoadMap(Settings->LatencyTestMap.GetLongPackageName(), false, true))
+	{
+		AddError(FString::Printf(TEXT("Could not load %s"), *Settings->LatencyTestMap.ToString()));
+		return false;
+	}
+
+	ULevelEditorPlaySettings* PlaySettings = NewObject<ULevelEditorPlaySettings>();
+	PlaySettings->SetPlayNetMode(EPlayNetMode::PIE_ListenServer);
+	PlaySettings->SetPlayNumberOfClients(2);
+	PlaySettings->bLaunchSeparateServer = false;
+	PlaySettings->SetRunUnderOneProcess(true);
+
+	FRequestPlaySessionParams PlayParams;
+	PlayParams.EditorPlaySettings = PlaySettings;
+	GEditor->RequestPlaySession(PlayParams);
+
+	IConsoleVariable* PredictCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("Mythos.Ability.PredictCostAndCooldown"));
+	TSharedRef<FState> State = MakeShared<FState>();
+	State->StepStartTime = FPlatformTime::Seconds();
+	State->bPreviousPredict = PredictCVar && PredictCVar->GetBool();
+
+	// Wait for the client to get its pawn and the ability, then add the lag
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State, AbilityTag, PktLagMs]()
+	{
+		UWorld* ClientWorld = FindClientWorld();
+		UAbilitySystemComponent* ClientASC = nullptr;
+		if (FindLocalAbility(ClientWorld, AbilityTag, ClientASC))
+		{
+			State->ClientWorld = ClientWorld;
+			GEngine->Exec(ClientWorld, *FString::Printf(TEXT("NetEmulation.PktLag %d"), PktLagMs));
+			State->StepStartTime = FPlatformTime::Seconds();
+			return true;
+		}
+
+		if (FPlatformTime::Seconds() - State->StepStartTime > 30.0)
+		{
+			AddError(FString::Printf(TEXT("The client never got a pawn with %s"), *AbilityTag.ToString()));
+			State->bFailed = true;
+			return true;
+		}
+		return false;
+	}));
+
+	// Give the lag a second to apply, then cast through the probe
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State, AbilityTag, PredictCVar]()
+	{
+		if (State->bFailed)
+		{
+			return true;
+		}
+		if (FPlatformTime::Seconds() - State->StepStartTime < 1.0)
+		{
+			return false;
+		}
+
+		UWorld* ClientWorld = State->ClientWorld.Get();
+		UMythosNetReportSubsystem* Probe = ClientWorld ? ClientWorld->GetSubsystem<UMythosNetReportSubsystem>() : nullptr;
+		UAbilitySystemComponent* ClientASC = nullptr;
+		FGameplayAbilitySpec* Spec = FindLocalAbility(ClientWorld, AbilityTag, ClientASC);
+		if (!Probe || !Spec)
+		{
+			AddError(TEXT("The client world went away"));
+			State->bFailed = true;
+			return true;
+		}
+
+		if (PredictCVar)
+		{
+			PredictCVar->Set(true);
+		}
+		Probe->StartAbilityLatencyProbe(AbilityTag);
+
+		// The predicted cooldown is already on the client, the server has not even seen the activation
+		TestFalse(TEXT("Predicted cooldown blocks activating again"), Spec->Ability->CheckCooldown(Spec->Handle, ClientASC->AbilityActorInfo.Get()));
+		return true;
+	}));
+
+	// The probe gives up after 2 seconds, anything it saw by then is in its latencies
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([this, State, PktLagMs]()
+	{
+		if (State->bFailed)
+		{
+			return true;
+		}
+
+		UWorld* ClientWorld = State->ClientWorld.Get();
+		UMythosNetReportSubsystem* Probe = ClientWorld ? ClientWorld->GetSubsystem<UMythosNetReportSubsystem>() : nullptr;
+		if (Probe && Probe->IsAbilityLatencyProbeRunning())
+		{
+			return false;
+		}
+
+		const double RoundTripSeconds = PktLagMs / 1000.0;
+		const double CostLatency = Probe ? Probe->GetProbeCostLatency() : -1.0;
+		const double CooldownLatency = Probe ? Probe->GetProbeCooldownLatency() : -1.0;
+		AddInfo(FString::Printf(TEXT("Cost after %.1f ms, cooldown after %.1f ms, %d ms lag"), CostLatency * 1000.0, CooldownLatency * 1000.0, PktLagMs));
+
+		TestTrue(TEXT("Cost landed on the client"), CostLatency >= 0.0);
+		TestTrue(TEXT("Cooldown landed on the client"), CooldownLatency >= 0.0);
+		TestTrue(TEXT("Cost did not wait for the server"), CostLatency < RoundTripSeconds * 0.5);
+		TestTrue(TEXT("Cooldown did not wait for the server"), CooldownLatency < RoundTripSeconds * 0.5);
+		return true;
+	}));
+
+	ADD_LATENT_AUTOMATION_COMMAND(FFunctionLatentCommand([State, PredictCVar]()
+	{
+		if (PredictCVar)
+		{
+			PredictCVar->Set(State->bPreviousPredict);
+		}
+		GEditor->RequestEndPlayMap();
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,49 @@
+#!/usr/bin/env python3
+"""Regenerate the native gameplay tag registry from Config/DefaultGameplayTags.ini.
+
+Mythos.Build.cs refuses to build when the registry and the ini disagree; run this
+script after adding or removing tags in the editor.
+"""
+
+import os
+import re
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INI_PATH = os.path.join(ROOT, "Config", "DefaultGameplayTags.ini")
+TAGS_DIR = os.path.join(ROOT, "Source", "Mythos", "Core", "AbilitySystem", "Tags")
+
+# Shared with Mythos.Build.cs so the generator and the build check read the ini the same way
+PATTERN_PATH = os.path.join(ROOT, "Tools", "GameplayTagPattern.txt")
+
+BANNER = ("// Generated from Config/DefaultGameplayTags.ini by Tools/GenerateGameplayTags.py, do not edit by hand.\n"
+          "// Mythos.Build.cs checks that this list matches the ini.\n")
+
+
+def identifier(tag):
+    return re.sub(r"[^A-Za-z0-9_]", "_", tag)
+
+
+def main():
+    with open(PATTERN_PATH, encoding="utf-8") as f:
+        tag_pattern = re.compile(f.read().strip(), re.MULTILINE)
+    with open(INI_PATH, encoding="utf-8") as f:
+        tags = tag_pattern.findall(f.read())
+
+    header = [BANNER, "\n#pragma once\n\n#include \"NativeGameplayTags.h\"\n\nnamespace MythosGameplayTags\n{\n"]
+    source = [BANNER, "\n#include \"Core/AbilitySystem/Tags/MythosGameplayTags.h\"\n\nnamespace MythosGameplayTags\n{\n"]
+    for tag, comment in tags:
+        name = identifier(tag)
+        header.append(f"\tMYTHOS_API UE_DECLARE_GAMEPLAY_TAG_EXTERN({name});\n")
+        source.append(f"\tUE_DEFINE_GAMEPLAY_TAG_COMMENT({name}, \"{tag}\", \"{comment}\");\n")
+    header.append("}\n")
+    source.append("}\n")
+
+    with open(os.path.join(TAGS_DIR, "MythosGameplayTags.h"), "w", encoding="utf-8", newline="\n") as f:
+        f.write("".join(header))
+    with open(os.path.join(TAGS_DIR, "MythosGameplayTags.cpp"), "w", encoding="utf-8", newline="\n") as f:
+        f.write("".join(source))
+    print(f"Wrote {len(tags)} native tags to {TAGS_DIR}")
+
+
+if __name__ == "__main__":
+    main()
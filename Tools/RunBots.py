@@ -0,0 +1,104 @@
+#!/usr/bin/env python3
+"""Generate multiplayer load with headless bot clients and aggregate their reports.
+
+Launches a local dedicated server (unless --no-server) and N bot clients started with -MythosBot
+(see AMythosPlayerController), waits for the bots to finish and prints per-bot and combined
+ping and prediction-rejection stats. Reports are JSON files written by each bot.
+
+    Tools/RunBots.py --server Binaries/Linux/MythosServer --client Binaries/Linux/Mythos --map /Game/Maps/Arena --bots 16 --seconds 300
+"""
+
+import argparse
+import glob
+import json
+import os
+import subprocess
+import sys
+import time
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+
+def percentile(values, p):
+    if not values:
+        return 0.0
+    values = sorted(values)
+    index = min(max(int(-(-p * len(values) // 1)) - 1, 0), len(values) - 1)
+    return values[index]
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("--server", help="dedicated server binary")
+    parser.add_argument("--client", required=True, help="game client binary")
+    parser.add_argument("--map", default="", help="map the server loads")
+    parser.add_argument("--host", default="127.0.0.1:7777")
+    parser.add_argument("--bots", type=int, default=8)
+    parser.add_argument("--seconds", type=float, default=120.0)
+    parser.add_argument("--stagger", type=float, default=0.5, help="seconds between bot launches")
+    parser.add_argument("--no-server", action="store_true", help="connect to an already running server")
+    parser.add_argument("--out", default=os.path.join(ROOT, "Saved", "Bots"))
+    args = parser.parse_args()
+
+    os.makedirs(args.out, exist_ok=True)
+    for stale in glob.glob(os.path.join(args.out, "Bot-*.json")):
+        os.remove(stale)
+
+    server = None
+    if not args.no_server:
+        if not args.server:
+            parser.error("--server is required unless --no-server is given")
+        server = subprocess.Popen([args.server, args.map, "-log", "-unattended",
+                                   "-abslog=" + os.path.join(args.out, "Server.log")])
+        # give the server time to load the map before the first bot connects
+        time.sleep(10.0)
+
+    bots = []
+    for bot in range(args.bots):
+        report = os.path.join(args.out, f"Bot-{bot}.json")
+        bots.append(subprocess.Popen([args.client, args.host, "-nullrhi", "-nosound", "-unattended", "-nosplash",
+                                      "-MythosBot", f"-MythosBotId={bot}", f"-MythosBotSeconds={args.seconds}",
+                                      f"-MythosBotReport={report}", "-abslog=" + os.path.join(args.out, f"Bot-{bot}.log")]))
+        time.sleep(args.stagger)
+
+    # bots exit on their own once their time is up, the margin covers loading and connecting
+    deadline = time.time() + args.seconds + 120.0
+    for process in bots:
+        try:
+            process.wait(timeout=max(deadline - time.time(), 1.0))
+        except subprocess.TimeoutExpired:
+            process.kill()
+
+    if server:
+        server.terminate()
+        server.wait()
+
+    reports = []
+    for path in sorted(glob.glob(os.path.join(args.out, "Bot-*.json"))):
+        with open(path, encoding="utf-8") as f:
+            reports.append(json.load(f))
+
+    if not reports:
+        print("no bot reports found in", args.out)
+        return 1
+
+    print(f"{'bot':>4} {'seconds':>8} {'casts':>6} {'active':>6} {'rejected':>8} {'ping p50':>9} {'ping p99':>9}")
+    for r in reports:
+        print(f"{r['bot']:>4} {r['seconds']:>8.0f} {r['castAttempts']:>6} {r['castsActivated']:>6} "
+              f"{r['predictionRejections']:>8} {r['pingP50']:>9.1f} {r['pingP99']:>9.1f}")
+
+    casts = sum(r["castAttempts"] for r in reports)
+    rejected = sum(r["predictionRejections"] for r in reports)
+    print(f"\n{len(reports)}/{args.bots} bots reported, {casts} casts, {rejected} rejected "
+          f"({100.0 * rejected / max(casts, 1):.2f}%), ping p50 of bots {percentile([r['pingP50'] for r in reports], 0.5):.1f}ms, "
+          f"worst p99 {max(r['pingP99'] for r in reports):.1f}ms")
+
+    summary = os.path.join(args.out, "Summary.json")
+    with open(summary, "w", encoding="utf-8") as f:
+        json.dump({"bots": reports, "casts": casts, "predictionRejections": rejected}, f, indent=2)
+    print("summary written to", summary)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())